@@ -0,0 +1,191 @@
+#include "batchrunner.h"
+
+#include <QDebug>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QStringList>
+#include <QTextStream>
+#include <QThread>
+#include <QThreadPool>
+#include <algorithm>
+#include <atomic>
+#include "ScenarioLoader.h"
+
+// ================= Corrida individual =================
+
+namespace {
+
+struct BatchItem {
+    std::shared_ptr<const ScenarioData> scenario;   // Compartido por todas las semillas
+    QString scenarioName;
+    QVector<QString> policyNames;
+    std::uint64_t seed;
+};
+
+void runBatchItem(const BatchItem& item, const BatchConfig& config, BatchRunResult& result) {
+    result.scenarioName = item.scenarioName;
+    result.policyNames = item.policyNames;
+    result.seed = item.seed;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    try {
+        EvolutionaryAlgorithm ea(item.scenario, item.policyNames, config.populationSize,
+                                 config.crossoverRate, config.mutationRates, item.seed);
+
+        // Un controlador por corrida: el crédito no se mezcla entre semillas
+        OperatorRateController rateController(config.rateControl);
+        if (config.rateControl.enabled) {
+            rateController.reset(config.mutationRates, config.crossoverRate);
+            ea.setOperatorRateController(&rateController);
+        }
+
+        ea.initialize();
+        for (int gen = 0; gen < config.numGenerations; ++gen) {
+            ea.runGeneration();
+        }
+
+        result.finalHypervolumes = ea.getHypervolumes().last();
+        result.evaluations = ea.getEvaluationCount();
+
+        // Frente de cada política: puntos distintos de nivel 1, ordenados por makespan
+        const QVector<Individual>& population = ea.getPopulation();
+        for (int c = 0; c < item.policyNames.size(); ++c) {
+            QVector<QPair<double, double>> front;
+            for (const Individual& ind : population) {
+                const Chromosome& chrom = ind.chromosomes[c];
+                if (chrom.domLevel == 1) {
+                    front.append(qMakePair(chrom.f1, chrom.f2));
+                }
+            }
+            std::sort(front.begin(), front.end());
+            front.erase(std::unique(front.begin(), front.end()), front.end());
+            result.fronts.append(front);
+        }
+    } catch (const std::exception& e) {
+        result.error = e.what();
+    }
+
+    result.wallSeconds = timer.nsecsElapsed() / 1e9;
+    if (result.wallSeconds > 0.0) {
+        result.evaluationsPerSecond = result.evaluations / result.wallSeconds;
+    }
+}
+
+QString csvField(QString value) {
+    value.replace("\"", "\"\"");
+    return "\"" + value + "\"";
+}
+
+} // namespace
+
+// ================= Campaña =================
+
+BatchRunner::BatchRunner(const BatchConfig& config)
+    : config(config) {
+}
+
+bool BatchRunner::run() {
+    results.clear();
+
+    QDir dir(config.scenarioDir);
+    const QStringList files = dir.entryList({"*.txt"}, QDir::Files, QDir::Name);
+    if (files.isEmpty()) {
+        qWarning() << "No hay escenarios en" << config.scenarioDir;
+        return false;
+    }
+
+    // Cada (escenario, conjunto de políticas) se parsea una sola vez
+    QVector<BatchItem> items;
+    for (const QString& file : files) {
+        for (const QVector<QString>& policies : config.policySets) {
+            std::shared_ptr<const ScenarioData> scenario;
+            try {
+                scenario = std::make_shared<const ScenarioData>(
+                    loadScenario(dir.filePath(file), policies));
+            } catch (const std::exception& e) {
+                qWarning() << "Se omite" << file << ":" << e.what();
+                continue;
+            }
+
+            for (int s = 0; s < config.numSeeds; ++s) {
+                items.append({scenario, QFileInfo(file).completeBaseName(), policies,
+                              config.baseSeed + static_cast<std::uint64_t>(s)});
+            }
+        }
+    }
+
+    const int slots = config.maxConcurrentRuns > 0 ? config.maxConcurrentRuns
+                                                   : QThread::idealThreadCount();
+    qInfo() << "Corridas:" << items.size() << "en" << slots << "ranuras";
+
+    // Cada tarea escribe solo su posición: se reserva y se toma el puntero antes de lanzar
+    results = QVector<BatchRunResult>(items.size());
+    BatchRunResult* out = results.data();
+    const BatchItem* in = items.constData();
+    std::atomic<int> finished{0};
+    const int total = items.size();
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(slots);
+    for (int i = 0; i < total; ++i) {
+        pool.start([this, in, out, i, total, &finished]() {
+            runBatchItem(in[i], config, out[i]);
+            qInfo().noquote() << QString("[%1/%2] %3 semilla %4: %5 s")
+                                     .arg(++finished).arg(total)
+                                     .arg(out[i].scenarioName).arg(out[i].seed)
+                                     .arg(out[i].wallSeconds, 0, 'f', 2);
+        });
+    }
+    pool.waitForDone();
+
+    return writeSummary(config.summaryPath);
+}
+
+const QVector<BatchRunResult>& BatchRunner::getResults() const {
+    return results;
+}
+
+bool BatchRunner::writeSummary(const QString& path) const {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qWarning() << "No se pudo escribir el resumen:" << path;
+        return false;
+    }
+
+    QTextStream out(&file);
+
+    // Una fila por corrida y política; el frente va como "makespan:energia;..."
+    out << "Scenario,Policies,Seed,Policy,Hypervolume,FrontSize,Front,"
+           "WallSeconds,Evaluations,EvaluationsPerSecond,Error\n";
+
+    for (const BatchRunResult& r : results) {
+        const QString policies = QStringList(r.policyNames.begin(), r.policyNames.end()).join('+');
+
+        for (int c = 0; c < r.policyNames.size(); ++c) {
+            QStringList points;
+            if (c < r.fronts.size()) {
+                for (const QPair<double, double>& p : r.fronts[c]) {
+                    points << QString("%1:%2").arg(p.first).arg(p.second);
+                }
+            }
+
+            out << r.scenarioName << ","
+                << policies << ","
+                << r.seed << ","
+                << r.policyNames[c] << ","
+                << r.finalHypervolumes.value(c) << ","
+                << points.size() << ","
+                << csvField(points.join(';')) << ","
+                << r.wallSeconds << ","
+                << r.evaluations << ","
+                << r.evaluationsPerSecond << ","
+                << csvField(r.error) << "\n";
+        }
+    }
+
+    return true;
+}
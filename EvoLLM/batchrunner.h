@@ -0,0 +1,76 @@
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include <QVector>
+#include <QString>
+#include <QPair>
+#include <cstdint>
+#include <memory>
+#include "EvolutionaryAlgorithm.h"
+
+/**
+ * @brief Parámetros de una campaña de experimentos (escenario × semilla × configuración)
+ */
+struct BatchConfig {
+    QString scenarioDir = "escenarios";     // Se ejecutan todos los .txt del directorio
+    int numSeeds = 30;                      // Semillas baseSeed, baseSeed + 1, ...
+    std::uint64_t baseSeed = 1;
+    QVector<QVector<QString>> policySets = { {"FIFO", "LTP"} };
+
+    int numGenerations = 100;
+    int populationSize = 50;
+    float crossoverRate = 0.8f;
+    QVector<float> mutationRates = QVector<float>(MutationCount, 0.1f);
+    OperatorRateSettings rateControl;       // Tasas adaptativas en cada corrida (enabled = false: fijas)
+
+    int maxConcurrentRuns = 0;              // 0 = QThread::idealThreadCount()
+    QString summaryPath = "batch_summary.csv";
+};
+
+/**
+ * @brief Resultado de una corrida individual de la campaña
+ */
+struct BatchRunResult {
+    QString scenarioName;
+    QVector<QString> policyNames;
+    std::uint64_t seed = 0;
+
+    QVector<double> finalHypervolumes;                      // Uno por política
+    QVector<QVector<QPair<double, double>>> fronts;         // (makespan, energía) del frente de cada política
+    double wallSeconds = 0.0;
+    long long evaluations = 0;
+    double evaluationsPerSecond = 0.0;
+    QString error;                                          // Vacío si la corrida terminó bien
+};
+
+/**
+ * @brief Ejecutor de experimentos por lotes sin interfaz
+ *
+ * Cada escenario se carga una sola vez por conjunto de políticas y se comparte
+ * (inmutable) entre todas sus corridas. Las corridas se reparten en un
+ * QThreadPool con tantas ranuras como núcleos (o maxConcurrentRuns); cada corrida
+ * es un EvolutionaryAlgorithm serial, así que no compiten por hilos internos.
+ *
+ * Al terminar se escribe un único CSV con una fila por corrida y política.
+ */
+class BatchRunner {
+public:
+    explicit BatchRunner(const BatchConfig& config);
+
+    /**
+     * @brief Ejecuta la campaña completa y escribe el resumen
+     * @return false si no hay escenarios o no se pudo escribir el resumen
+     */
+    bool run();
+
+    const QVector<BatchRunResult>& getResults() const;
+
+    /** @brief Escribe el resumen CSV (también lo hace run() al terminar) */
+    bool writeSummary(const QString& path) const;
+
+private:
+    BatchConfig config;
+    QVector<BatchRunResult> results;
+};
+
+#endif // BATCH_RUNNER_H
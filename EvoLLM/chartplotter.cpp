@@ -1,4 +1,6 @@
 #include "ChartPlotter.h"
+#include "ganttwidget.h"
+#include "densitychartview.h"
 #include <limits>
 
 // --------------------------------
@@ -117,6 +119,9 @@ void ChartPlotter::plotPopulation(const QVector<Individual> &population, QWidget
         Qt::magenta, Qt::cyan, Qt::yellow, Qt::black
     };
 
+    // Con demasiados puntos se dibuja un mapa de densidad y solo el frente como scatter
+    const bool densityMode = population.size() * numChrom > kDensityPointThreshold;
+
     QChart *chart = new QChart();
     chart->setTitle("Población Total - Makespan vs Energía");
     chart->legend()->setVisible(true);
@@ -126,6 +131,8 @@ void ChartPlotter::plotPopulation(const QVector<Individual> &population, QWidget
     double minF2 = std::numeric_limits<double>::max();
     double maxF2 = std::numeric_limits<double>::lowest();
 
+    QVector<QVector<QPointF>> densityPoints(densityMode ? numChrom : 0);
+
     for (int c = 0; c < numChrom; ++c) {
 
         QScatterSeries *series = new QScatterSeries();
@@ -137,6 +144,11 @@ void ChartPlotter::plotPopulation(const QVector<Individual> &population, QWidget
         series->setBorderColor(color);
 
         series->setName("Cromosoma " + population[0].chromosomes[c].policyName);
+
+        // Se arma la lista completa y se entrega de una vez (un solo repintado)
+        QList<QPointF> points;
+        points.reserve(densityMode ? 0 : population.size());
+
         // Todas las soluciones de esta política
         for (const Individual &ind : population) {
             const auto &chrom = ind.chromosomes[c];
@@ -146,9 +158,17 @@ void ChartPlotter::plotPopulation(const QVector<Individual> &population, QWidget
             minF2 = std::min(minF2, chrom.f2);
             maxF2 = std::max(maxF2, chrom.f2);
 
-            series->append(chrom.f1, chrom.f2);
+            if (densityMode) {
+                densityPoints[c].append(QPointF(chrom.f1, chrom.f2));
+                if (chrom.domLevel == 1) {
+                    points.append(QPointF(chrom.f1, chrom.f2));
+                }
+            } else {
+                points.append(QPointF(chrom.f1, chrom.f2));
+            }
         }
 
+        series->replace(points);
         chart->addSeries(series);
     }
     // Ejes con margen
@@ -172,7 +192,18 @@ void ChartPlotter::plotPopulation(const QVector<Individual> &population, QWidget
         s->attachAxis(axisY);
     }
 
-    QChartView *chartView = new QChartView(chart);
+    QChartView *chartView;
+    if (densityMode) {
+        // El histograma se calcula en otro hilo; el frente queda encima
+        DensityChartView *densityView = new DensityChartView(chart);
+        densityView->setDensityData(densityPoints,
+                                    QRectF(QPointF(minF1 - marginX, minF2 - marginY),
+                                           QPointF(maxF1 + marginX, maxF2 + marginY)),
+                                    colors);
+        chartView = densityView;
+    } else {
+        chartView = new QChartView(chart);
+    }
     chartView->setRenderHint(QPainter::Antialiasing);
     chartView->setMinimumHeight(600);
 
@@ -266,7 +297,8 @@ void ChartPlotter::plotHypervolumeEvolution(
  */
 void ChartPlotter::plotParameterEvolution(
     const QVector<QVector<double>>& parameters,
-    QWidget *widget)
+    QWidget *widget,
+    const QVector<int>& adviceGenerations)
 {
     if (parameters.isEmpty())
         return;
@@ -323,6 +355,34 @@ void ChartPlotter::plotParameterEvolution(
         seriesList.append(series);
     }
 
+    // -------------------------
+    // CONSEJOS APLICADOS
+    // -------------------------
+    // Una línea vertical por consejo; una sola entrada en la leyenda
+    bool adviceInLegend = false;
+    for (int generation : adviceGenerations) {
+        if (generation < 0 || generation >= numGenerations)
+            continue;
+
+        QLineSeries *marker = new QLineSeries();
+        marker->setName("Consejo aplicado");
+
+        QPen pen(Qt::darkGray);
+        pen.setStyle(Qt::DashLine);
+        marker->setPen(pen);
+
+        marker->append(generation, 0.0);
+        marker->append(generation, 1.0);
+
+        chart->addSeries(marker);
+        seriesList.append(marker);
+
+        if (adviceInLegend) {
+            chart->legend()->markers(marker).first()->setVisible(false);
+        }
+        adviceInLegend = true;
+    }
+
     // -------------------------
     // EJES
     // -------------------------
@@ -358,10 +418,9 @@ void ChartPlotter::plotParameterEvolution(
 }
 
 void ChartPlotter::plotGanttChart(
-    const ScenarioData& scenario,
-    const Individual ind,
+    const Individual& ind,
     QWidget *widget,
-    EvolutionaryAlgorithm& ea)
+    ScheduleCache& schedules)
 {
     // -------------------------
     // LIMPIAR WIDGET
@@ -388,19 +447,13 @@ void ChartPlotter::plotGanttChart(
     grid->setSpacing(15);
     grid->setContentsMargins(10, 10, 10, 10);
 
-    // -------------------------
-    // PARÁMETROS GANTT
-    // -------------------------
-    const double yStep = 40.0;
-    const double rectHeight = 30.0;
-    const double timeScale = 10.0;
-
     int row = 0;
 
     // -------------------------
     // UN GANTT POR CROMOSOMA
     // -------------------------
-    for (Chromosome chromosome : ind.chromosomes) {
+    for (int c = 0; c < ind.chromosomes.size(); ++c) {
+        const Chromosome &chromosome = ind.chromosomes[c];
 
         // -------- TÍTULO --------
         QLabel *title = new QLabel(chromosome.policyName);
@@ -410,74 +463,18 @@ void ChartPlotter::plotGanttChart(
         grid->addWidget(title, row, 0);
         row++;
 
-        // -------- EVALUAR --------
-        const QVector<OperationSchedule> &schedule =
-            ea.evaluateChromosome(chromosome);
-
-        // -------- SCENE / VIEW --------
-        QGraphicsScene *scene = new QGraphicsScene();
-        scene->setBackgroundBrush(Qt::white);
-
-        QGraphicsView *view = new QGraphicsView(scene);
-        view->setRenderHint(QPainter::Antialiasing);
-        view->setAlignment(Qt::AlignLeft | Qt::AlignTop);
-        view->setHorizontalScrollBarPolicy(Qt::ScrollBarAsNeeded);
-        view->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
-
-        QMap<int, QColor> jobColors;
-        QRandomGenerator rng(QRandomGenerator::global()->generate());
-
-        double maxEndTime = 0.0;
-
-        // -------- DIBUJAR OPERACIONES --------
-        for (const OperationSchedule &op : schedule) {
-
-            if (!jobColors.contains(op.jobId)) {
-                jobColors[op.jobId] = QColor::fromRgb(
-                    rng.bounded(50, 256),
-                    rng.bounded(50, 256),
-                    rng.bounded(50, 256)
-                    );
-            }
-
-            double x = op.startTime * timeScale;
-            double y = op.machineId * yStep;
-            double width = op.processingTime * timeScale;
-
-            maxEndTime = std::max(maxEndTime, op.endTime);
-
-            scene->addRect(
-                x, y,
-                width, rectHeight,
-                QPen(Qt::black),
-                QBrush(jobColors[op.jobId])
-                );
-
-            QGraphicsTextItem *label = scene->addText(
-                QString("J%1-O%2").arg(op.jobId).arg(op.operationId),
-                QFont("Arial", 8)
-                );
-            label->setPos(x + 3, y + 3);
-        }
-
-        // -------- ETIQUETAS DE MÁQUINAS --------
-        for (int m = 0; m < scenario.numMachines; ++m) {
-            QGraphicsTextItem *machineLabel = scene->addText(
-                QString("M%1").arg(m),
-                QFont("Arial", 9, QFont::Bold)
-                );
-            machineLabel->setPos(-40, m * yStep);
-        }
-
-        // -------- SCENE SIZE --------
-        double sceneWidth = maxEndTime * timeScale + 100;
-        double sceneHeight = scenario.numMachines * yStep + 30;
+        // -------- PROGRAMACIÓN (desde la caché) --------
+        std::shared_ptr<const DecodedSchedule> schedule =
+            schedules.get(c, chromosome.genes);
 
-        scene->setSceneRect(0, 0, sceneWidth, sceneHeight);
-        view->setMinimumHeight(sceneHeight + 10);
-        view->setMinimumWidth(600);
+        // -------- GANTT --------
+        // Arreglos compactos por máquina; solo se dibuja la ventana visible
+        GanttWidget *gantt = new GanttWidget();
+        gantt->setSchedule(*schedule);
+        gantt->setMinimumHeight(std::min(gantt->contentHeight() + 20, 600));
+        gantt->setMinimumWidth(600);
 
-        grid->addWidget(view, row, 0);
+        grid->addWidget(gantt, row, 0);
         row++;
     }
 
@@ -5,7 +5,7 @@
 #include <QWidget>              // Clase base para los widgets donde se mostrarán las gráficas
 #include "Individual.h"         // Donde está definida la estructura Individual (y Chromosome)
 #include "scenariodata.h"       // Contiene la información del problema (máquinas, jobs, etc.)
-#include "EvolutionaryAlgorithm.h" // Clase que contiene la lógica de evaluación del algoritmo evolutivo
+#include "schedulecache.h"      // Programaciones ya decodificadas, compartidas entre vistas
 
 /**
  * @brief Clase estática encargada de generar diferentes tipos de visualizaciones
@@ -54,25 +54,27 @@ public:
      * 
      * @param parameters parameters[g][p] = valor del hiperparámetro p en generación g
      * @param widget Widget donde se dibujará la evolución
+     * @param adviceGenerations Generaciones desde las que rigió cada consejo del LLM
+     *        (se marcan con una línea vertical)
      */
     static void plotParameterEvolution(
         const QVector<QVector<double>>& parameters,
-        QWidget *widget);
+        QWidget *widget,
+        const QVector<int>& adviceGenerations = {});
 
     /**
      * @brief Genera uno o varios diagramas de Gantt (uno por política/cromosoma)
      * mostrando la programación detallada de operaciones en las máquinas
+     * (un GanttWidget por política: escala a programaciones con decenas de miles de operaciones)
      * 
-     * @param scenario Datos del problema (jobs, operaciones, máquinas, tiempos...)
      * @param ind Individuo/solución a visualizar (contiene varios cromosomas/políticas)
      * @param containerWidget Widget donde se colocará el área con scroll con los Gantt
-     * @param ea Instancia del algoritmo evolutivo (necesaria para evaluar el cromosoma)
+     * @param schedules Caché de programaciones (no decodifica si ya estaban)
      */
     static void plotGanttChart(
-        const ScenarioData& scenario,
-        const Individual ind,
+        const Individual& ind,
         QWidget *containerWidget,
-        EvolutionaryAlgorithm& ea);
+        ScheduleCache& schedules);
 
 private:
     /**
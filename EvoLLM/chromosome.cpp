@@ -7,7 +7,9 @@ Chromosome::Chromosome()
       f1(0.0),                  // Objetivo 1 (normalmente Makespan)
       f2(0.0),                  // Objetivo 2 (normalmente Consumo de energía)
       domLevel(-1),             // Nivel de dominancia (se calcula después)
-      crowdingDistance(-1)      // Distancia de crowding (para NSGA-II, -1 = no calculado)
+      crowdingDistance(-1),     // Distancia de crowding (para NSGA-II, -1 = no calculado)
+      operators(0),             // Ningún operador lo ha tocado todavía
+      operatorEpoch(-1)
 {
     // No hace nada más, los vectores se inicializan vacíos por defecto
 }
@@ -19,22 +21,24 @@ Chromosome::Chromosome(const QString& name)
       f1(0.0),                  // Objetivos aún sin evaluar
       f2(0.0),
       domLevel(-1),             // Aún no evaluado en términos de dominancia
-      crowdingDistance(-1)      // Aún no calculada la distancia de crowding
+      crowdingDistance(-1),     // Aún no calculada la distancia de crowding
+      operators(0),
+      operatorEpoch(-1)
 {
     // Similar al constructor por defecto, solo cambia el nombre
 }
 
 // Inicializa el cromosoma con valores aleatorios
 // Genera una secuencia aleatoria de enteros que representa la solución codificada
-void Chromosome::initializeRandom(int size, int minValue, int maxValue, QRandomGenerator& rng)
+void Chromosome::initializeRandom(int size, int minValue, int maxValue, Rng& rng)
 {
     genes.clear();              // Asegura que el vector esté vacío antes de empezar
     genes.reserve(size);        // Reserva espacio para mejorar eficiencia (evita realocaciones)
 
     // Genera 'size' valores enteros aleatorios en el rango [minValue, maxValue]
     for (int i = 0; i < size; ++i) {
-        genes.append(rng.bounded(minValue, maxValue + 1));
-        // Nota: bounded(a, b) genera [a, b-1] → por eso +1 en el límite superior
+        genes.append(minValue + static_cast<int>(rng.bounded(maxValue - minValue + 1)));
+        // Nota: bounded(n) genera [0, n-1] → por eso +1 en el rango
     }
 }
 
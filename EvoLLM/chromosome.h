@@ -3,7 +3,8 @@
 
 #include <QString>              // Para manejar nombres de políticas como cadenas
 #include <QVector>              // Contenedor para la secuencia de genes
-#include <QRandomGenerator>     // Generador de números aleatorios (usado en inicialización)
+#include <cstdint>
+#include "rng.h"                // Generador de números aleatorios (usado en inicialización)
 
 /**
  * @brief Representa una solución candidata (individuo) en un algoritmo evolutivo
@@ -28,6 +29,9 @@ public:
     double crowdingDistance;        // Distancia de crowding (diversidad en NSGA-II)
                                     // -1 = no calculada, mayor valor = más diversa en su frente
 
+    std::uint8_t operators;         // Operadores que produjeron estos genes (un bit por OperatorArm)
+    int operatorEpoch;              // Generación en que se marcaron (-1 = ninguna); para el crédito
+
     // Constructores
     /**
      * @brief Constructor por defecto
@@ -49,7 +53,7 @@ public:
      * @param maxValue Valor máximo posible para cada gen
      * @param rng Generador de números aleatorios (se pasa por referencia)
      */
-    void initializeRandom(int size, int minValue, int maxValue, QRandomGenerator& rng);
+    void initializeRandom(int size, int minValue, int maxValue, Rng& rng);
 
     /**
      * @brief Devuelve el número actual de genes en el cromosoma
@@ -0,0 +1,96 @@
+#include "crossover.h"
+
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+// =======================
+// MÁSCARA ALEATORIA
+// =======================
+void fillCrossoverMask(QVector<std::uint64_t>& mask, int geneCount, Rng& rng)
+{
+    const int words = crossoverMaskWords(geneCount);
+    mask.resize(words);
+
+    // Rng entrega 64 bits por llamada → una llamada por palabra
+    for (int w = 0; w < words; ++w) {
+        mask[w] = rng();
+    }
+}
+
+// =======================
+// BLEND ESCALAR (colas y fallback)
+// =======================
+static inline void blendScalar(const int* parent1, const int* parent2,
+                               int* child1, int* child2,
+                               std::uint64_t bits, int begin, int end)
+{
+    for (int g = begin; g < end; ++g) {
+        // -1 (todos los bits a 1) si el gen viene del padre 1, 0 en otro caso
+        const int m = -static_cast<int>((bits >> (g - begin)) & 1u);
+        const int a = parent1[g];
+        const int b = parent2[g];
+        child1[g] = (a & m) | (b & ~m);
+        child2[g] = (b & m) | (a & ~m);
+    }
+}
+
+// =======================
+// BLEND SIMD
+// =======================
+void blendCrossover(const int* parent1,
+                    const int* parent2,
+                    int* child1,
+                    int* child2,
+                    const std::uint64_t* mask,
+                    int geneCount)
+{
+    int g = 0;
+
+#if defined(__AVX2__)
+    // 8 genes (int32) por registro: un byte de la máscara por bloque
+    const __m256i laneBits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+
+    for (; g + 8 <= geneCount; g += 8) {
+        const int bits = static_cast<int>((mask[g >> 6] >> (g & 63)) & 0xFFu);
+        const __m256i sel = _mm256_cmpeq_epi32(
+            _mm256_and_si256(_mm256_set1_epi32(bits), laneBits), laneBits);
+
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(parent1 + g));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(parent2 + g));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(child1 + g), _mm256_blendv_epi8(b, a, sel));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(child2 + g), _mm256_blendv_epi8(a, b, sel));
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    // 4 genes (int32) por registro: medio byte de la máscara por bloque
+    const __m128i laneBits = _mm_setr_epi32(1, 2, 4, 8);
+
+    for (; g + 4 <= geneCount; g += 4) {
+        const int bits = static_cast<int>((mask[g >> 6] >> (g & 63)) & 0xFu);
+        const __m128i sel = _mm_cmpeq_epi32(
+            _mm_and_si128(_mm_set1_epi32(bits), laneBits), laneBits);
+
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(parent1 + g));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(parent2 + g));
+
+        // SSE2 no tiene blendv: (a & sel) | (b & ~sel)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(child1 + g),
+                         _mm_or_si128(_mm_and_si128(sel, a), _mm_andnot_si128(sel, b)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(child2 + g),
+                         _mm_or_si128(_mm_and_si128(sel, b), _mm_andnot_si128(sel, a)));
+    }
+#endif
+
+    // Resto (o todo el cromosoma si no hay SIMD), por bloques de hasta 64 genes
+    while (g < geneCount) {
+        const int wordEnd = std::min(geneCount, (g & ~63) + 64);
+        blendScalar(parent1, parent2, child1, child2,
+                    mask[g >> 6] >> (g & 63), g, wordEnd);
+        g = wordEnd;
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef CROSSOVER_H
+#define CROSSOVER_H
+
+#include <cstdint>
+#include "rng.h"                    // Generador xoshiro256++
+#include <QVector>
+
+/**
+ * @file Crossover.h
+ * @brief Núcleo de la cruza uniforme basado en máscaras de bits
+ *
+ * En lugar de sortear un double por cada posición del cromosoma, se sortean
+ * palabras de 64 bits aleatorios: cada bit decide de qué padre hereda un gen.
+ * Con la máscara lista, los hijos se construyen mezclando (blend) las dos filas
+ * de genes de los padres con instrucciones SIMD cuando están disponibles.
+ *
+ * Convención de la máscara: bit = 1 → el hijo 1 toma el gen del padre 1
+ * (y el hijo 2 el del padre 2); bit = 0 → al revés.
+ */
+
+/**
+ * @brief Número de palabras de 64 bits necesarias para 'geneCount' genes
+ */
+inline int crossoverMaskWords(int geneCount)
+{
+    return (geneCount + 63) / 64;
+}
+
+/**
+ * @brief Llena la máscara con bits aleatorios uniformes (64 por palabra)
+ *
+ * @param mask Vector de salida; se redimensiona a crossoverMaskWords(geneCount)
+ * @param geneCount Número de genes a cubrir
+ * @param rng Generador de números aleatorios
+ */
+void fillCrossoverMask(QVector<std::uint64_t>& mask, int geneCount, Rng& rng);
+
+/**
+ * @brief Construye dos hijos mezclando las filas de genes de dos padres
+ *
+ * Los buffers de salida deben tener al menos 'geneCount' posiciones reservadas.
+ * La misma máscara puede reutilizarse para todos los cromosomas del individuo.
+ *
+ * @param parent1 Genes del padre 1
+ * @param parent2 Genes del padre 2
+ * @param child1 Salida: genes del hijo 1
+ * @param child2 Salida: genes del hijo 2
+ * @param mask Máscara de bits (ver convención arriba)
+ * @param geneCount Longitud del cromosoma
+ */
+void blendCrossover(const int* parent1,
+                    const int* parent2,
+                    int* child1,
+                    int* child2,
+                    const std::uint64_t* mask,
+                    int geneCount);
+
+#endif // CROSSOVER_H
@@ -0,0 +1,75 @@
+#include "deferredrenderer.h"
+
+#include <QEvent>
+#include <QTimer>
+
+DeferredRenderer::DeferredRenderer(QObject* parent)
+    : QObject(parent)
+{
+}
+
+// ================= Registro =================
+
+void DeferredRenderer::defer(QWidget* container, RenderFunction render)
+{
+    if (!container) {
+        return;
+    }
+
+    if (!pending.contains(container)) {
+        container->installEventFilter(this);
+        connect(container, &QObject::destroyed, this, [this, container]() {
+            pending.remove(container);
+        });
+    }
+    pending.insert(container, std::move(render));
+
+    // Ya en pantalla: no habrá otro Show, se construye en cuanto vuelva el bucle
+    if (container->isVisible()) {
+        QTimer::singleShot(0, this, [this, container]() { this->render(container); });
+    }
+}
+
+void DeferredRenderer::cancelAll()
+{
+    for (auto it = pending.cbegin(); it != pending.cend(); ++it) {
+        it.key()->removeEventFilter(this);
+        disconnect(it.key(), &QObject::destroyed, this, nullptr);
+    }
+    pending.clear();
+}
+
+bool DeferredRenderer::isPending(QWidget* container) const
+{
+    return pending.contains(container);
+}
+
+// ================= Construcción =================
+
+bool DeferredRenderer::eventFilter(QObject* watched, QEvent* event)
+{
+    if (event->type() == QEvent::Show) {
+        QWidget* container = static_cast<QWidget*>(watched);
+        if (pending.contains(container)) {
+            // Después del Show: el contenedor ya tiene su tamaño definitivo
+            QTimer::singleShot(0, this, [this, container]() { render(container); });
+        }
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+void DeferredRenderer::render(QWidget* container)
+{
+    // Pudo construirse ya (dos Show seguidos) o cancelarse mientras tanto
+    auto it = pending.find(container);
+    if (it == pending.end()) {
+        return;
+    }
+
+    RenderFunction renderFunction = std::move(it.value());
+    pending.erase(it);
+    container->removeEventFilter(this);
+    disconnect(container, &QObject::destroyed, this, nullptr);
+
+    renderFunction();
+}
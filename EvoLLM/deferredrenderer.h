@@ -0,0 +1,49 @@
+#ifndef DEFERREDRENDERER_H
+#define DEFERREDRENDERER_H
+
+#include <QObject>
+#include <QHash>
+#include <QWidget>
+#include <functional>
+
+/**
+ * @brief Construye las vistas de resultados solo cuando su contenedor se muestra
+ *
+ * Al terminar una corrida la interfaz registra, por cada contenedor (pestaña de
+ * hipervolumen, de hiperparámetros, cada Gantt, el resumen...), una función que
+ * construye la vista a partir de una instantánea ligera de los datos (contenedores
+ * Qt implícitamente compartidos, individuos sueltos, la caché de programaciones).
+ * Nada se construye hasta que el contenedor recibe su primer QEvent::Show, así
+ * que las vistas que nadie abre no cuestan tiempo ni memoria.
+ *
+ * Registrar otra función para el mismo contenedor reemplaza a la pendiente (la
+ * corrida nueva manda). Si el contenedor ya está visible, se construye en la
+ * siguiente vuelta del bucle de eventos.
+ */
+class DeferredRenderer : public QObject
+{
+    Q_OBJECT
+
+public:
+    using RenderFunction = std::function<void()>;
+
+    explicit DeferredRenderer(QObject* parent = nullptr);
+
+    /** @brief Registra (o reemplaza) la construcción pendiente de un contenedor */
+    void defer(QWidget* container, RenderFunction render);
+
+    /** @brief Descarta todo lo pendiente (al empezar otra corrida) */
+    void cancelAll();
+
+    bool isPending(QWidget* container) const;
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    QHash<QWidget*, RenderFunction> pending;
+
+    void render(QWidget* container);
+};
+
+#endif // DEFERREDRENDERER_H
@@ -0,0 +1,113 @@
+#include "densitychartview.h"
+#include <QtConcurrent>
+
+DensityChartView::DensityChartView(QChart* chart, QWidget* parent)
+    : QChartView(chart, parent)
+{
+    connect(&watcher, &QFutureWatcher<QImage>::finished, this, &DensityChartView::onRasterFinished);
+    connect(chart, &QChart::plotAreaChanged, this, &DensityChartView::requestRaster);
+}
+
+// ================= Datos =================
+
+void DensityChartView::setDensityData(const QVector<QVector<QPointF>>& points,
+                                      const QRectF& range,
+                                      const QVector<QColor>& colors)
+{
+    if (!densityActive) {
+        // El fondo del chart taparía la imagen: se pinta desde la vista
+        densityActive = true;
+        chart()->setBackgroundVisible(false);
+        setBackgroundBrush(Qt::white);
+    }
+
+    densityPoints = points;
+    densityRange = range;
+    densityColors = colors;
+    requestRaster();
+}
+
+void DensityChartView::clearDensity()
+{
+    if (!densityActive) {
+        return;
+    }
+
+    densityActive = false;
+    rasterQueued = false;
+    densityPoints.clear();
+    densityImage = QImage();
+    chart()->setBackgroundVisible(true);
+    resetCachedContent();
+    viewport()->update();
+}
+
+bool DensityChartView::isDensityActive() const
+{
+    return densityActive;
+}
+
+// ================= Cálculo en segundo plano =================
+
+void DensityChartView::requestRaster()
+{
+    if (!densityActive || densityPoints.isEmpty()) {
+        return;
+    }
+
+    // Una imagen a la vez; al terminar se calcula la más reciente
+    if (watcher.isRunning()) {
+        rasterQueued = true;
+        return;
+    }
+
+    const QSize size = chart()->plotArea().size().toSize();
+    if (size.isEmpty()) {
+        return;
+    }
+
+    rasterRange = densityRange;
+    watcher.setFuture(QtConcurrent::run(rasterizeDensity, densityPoints, densityRange,
+                                        size, densityColors));
+}
+
+void DensityChartView::onRasterFinished()
+{
+    if (densityActive) {
+        densityImage = watcher.result();
+        imageRange = rasterRange;
+        resetCachedContent();
+        viewport()->update();
+    }
+
+    if (rasterQueued) {
+        rasterQueued = false;
+        requestRaster();
+    }
+}
+
+// ================= Dibujo =================
+
+void DensityChartView::drawBackground(QPainter* painter, const QRectF& rect)
+{
+    QChartView::drawBackground(painter, rect);
+
+    if (!densityActive || densityImage.isNull() || densityRange.width() <= 0.0 || densityRange.height() <= 0.0) {
+        return;
+    }
+
+    // La imagen puede ser de un rango anterior (se está calculando la nueva):
+    // se ubica según los ejes actuales para que no se desalinee
+    const QRectF area = chart()->mapRectToScene(chart()->plotArea());
+    const double sx = area.width() / densityRange.width();
+    const double sy = area.height() / densityRange.height();
+    const QRectF target(area.left() + (imageRange.left() - densityRange.left()) * sx,
+                        area.bottom() - (imageRange.bottom() - densityRange.top()) * sy,
+                        imageRange.width() * sx,
+                        imageRange.height() * sy);
+
+    painter->save();
+    painter->setClipRect(area);
+    painter->drawImage(target, densityImage);
+    painter->restore();
+}
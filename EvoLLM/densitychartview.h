@@ -0,0 +1,62 @@
+#ifndef DENSITYCHARTVIEW_H
+#define DENSITYCHARTVIEW_H
+
+#include <QtCharts>             // QChartView, QChart
+#include <QFutureWatcher>
+#include <QImage>
+#include "densityraster.h"
+
+/**
+ * @brief QChartView que puede dibujar un mapa de densidad detrás de las series
+ *
+ * Con decenas de miles de puntos, una QScatterSeries deja de ser usable. En su
+ * lugar se calcula un histograma 2-D (rasterizeDensity) en otro hilo con
+ * QtConcurrent y se dibuja como imagen en el área de la gráfica; las series que
+ * sigan en el chart (por ejemplo, el frente de Pareto) quedan encima como vectores.
+ *
+ * Mientras se calcula una imagen, las peticiones nuevas se acumulan y solo se
+ * atiende la última. La imagen se recalcula cuando cambia el tamaño del área.
+ */
+class DensityChartView : public QChartView
+{
+    Q_OBJECT
+
+public:
+    explicit DensityChartView(QChart* chart, QWidget* parent = nullptr);
+
+    /**
+     * @brief Activa (o actualiza) el mapa de densidad
+     * @param points points[s] son los puntos de la serie s
+     * @param range Rango actual de los ejes (x = makespan, y = energía)
+     * @param colors Color de cada serie
+     */
+    void setDensityData(const QVector<QVector<QPointF>>& points,
+                        const QRectF& range,
+                        const QVector<QColor>& colors);
+
+    /** @brief Quita el mapa de densidad (vuelve al fondo normal del chart) */
+    void clearDensity();
+
+    bool isDensityActive() const;
+
+protected:
+    void drawBackground(QPainter* painter, const QRectF& rect) override;
+
+private slots:
+    void requestRaster();
+    void onRasterFinished();
+
+private:
+    bool densityActive = false;
+    QVector<QVector<QPointF>> densityPoints;
+    QRectF densityRange;
+    QVector<QColor> densityColors;
+
+    QFutureWatcher<QImage> watcher;
+    bool rasterQueued = false;              // Llegaron datos mientras se calculaba otra imagen
+    QRectF rasterRange;                     // Rango de la imagen en cálculo
+    QImage densityImage;
+    QRectF imageRange;                      // Rango de densityImage
+};
+
+#endif // DENSITYCHARTVIEW_H
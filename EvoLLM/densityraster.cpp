@@ -0,0 +1,74 @@
+#include "densityraster.h"
+#include <algorithm>
+#include <cmath>
+
+QImage rasterizeDensity(const QVector<QVector<QPointF>>& points,
+                        const QRectF& range,
+                        const QSize& size,
+                        const QVector<QColor>& colors)
+{
+    const int width = size.width();
+    const int height = size.height();
+    QImage image(std::max(1, width), std::max(1, height), QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+
+    if (width <= 0 || height <= 0 || range.width() <= 0.0 || range.height() <= 0.0 || colors.isEmpty()) {
+        return image;
+    }
+
+    const int cells = width * height;
+    QVector<int> total(cells, 0);
+    QVector<float> red(cells, 0.0f), green(cells, 0.0f), blue(cells, 0.0f);
+
+    const double scaleX = width / range.width();
+    const double scaleY = height / range.height();
+
+    // Conteo por celda y suma de colores de las series que caen en ella
+    for (int s = 0; s < points.size(); ++s) {
+        const QColor& color = colors[s % colors.size()];
+        const float r = color.redF(), g = color.greenF(), b = color.blueF();
+
+        for (const QPointF& p : points[s]) {
+            const double fx = (p.x() - range.left()) * scaleX;
+            const double fy = (p.y() - range.top()) * scaleY;
+            if (fx < 0.0 || fx > width || fy < 0.0 || fy > height) {
+                continue;
+            }
+            // El borde superior del rango cae en la última celda
+            const int x = std::min(width - 1, static_cast<int>(fx));
+            const int y = height - 1 - std::min(height - 1, static_cast<int>(fy));
+            const int cell = y * width + x;
+            total[cell]++;
+            red[cell] += r;
+            green[cell] += g;
+            blue[cell] += b;
+        }
+    }
+
+    const int maxCount = *std::max_element(total.begin(), total.end());
+    if (maxCount == 0) {
+        return image;
+    }
+    const double logMax = std::log1p(maxCount);
+
+    for (int y = 0; y < height; ++y) {
+        QRgb* line = reinterpret_cast<QRgb*>(image.scanLine(y));
+        for (int x = 0; x < width; ++x) {
+            const int cell = y * width + x;
+            const int count = total[cell];
+            if (count == 0) {
+                continue;
+            }
+
+            // Opacidad logarítmica con un mínimo para que ningún punto desaparezca
+            const double alpha = 0.25 + 0.75 * std::log1p(count) / logMax;
+            const int a = static_cast<int>(alpha * 255.0);
+            const int r = static_cast<int>(red[cell] / count * a);
+            const int g = static_cast<int>(green[cell] / count * a);
+            const int b = static_cast<int>(blue[cell] / count * a);
+            line[x] = qRgba(r, g, b, a);    // Premultiplicado
+        }
+    }
+
+    return image;
+}
@@ -0,0 +1,36 @@
+#ifndef DENSITYRASTER_H
+#define DENSITYRASTER_H
+
+#include <QImage>
+#include <QVector>
+#include <QPointF>
+#include <QRectF>
+#include <QSize>
+#include <QColor>
+
+// A partir de este total de puntos las gráficas de población usan el mapa de densidad
+// (por encima de unos 20 000 puntos Qt Charts deja de responder con scatter)
+const int kDensityPointThreshold = 20000;
+
+/**
+ * @brief Histograma 2-D de puntos (makespan, energía) convertido en imagen
+ *
+ * Cada píxel es una celda del histograma sobre 'range'. El color de la celda es la
+ * mezcla de los colores de las series según cuántos puntos aporta cada una, y la
+ * opacidad crece con el logaritmo del conteo (las celdas con un solo punto siguen
+ * viéndose junto a las muy pobladas). La fila 0 de la imagen es la energía máxima,
+ * para que se pueda dibujar tal cual sobre el área de la gráfica.
+ *
+ * Es una función pura: se puede llamar desde cualquier hilo (QtConcurrent).
+ *
+ * @param points points[s] son los puntos de la serie s
+ * @param range Rango de los ejes (x = makespan, y = energía)
+ * @param size Tamaño en píxeles del área de la gráfica
+ * @param colors Color de cada serie (se repiten cíclicamente)
+ */
+QImage rasterizeDensity(const QVector<QVector<QPointF>>& points,
+                        const QRectF& range,
+                        const QSize& size,
+                        const QVector<QColor>& colors);
+
+#endif // DENSITYRASTER_H
@@ -3,25 +3,91 @@
 #include <limits>
 #include <cmath>
 #include "mutations.h"
+#include "crossover.h"
+#include <thread>
+#include <mutex>
+#include <chrono>
 #include <QDebug>
 
+namespace {
+
+// Suma al contador de una fase el tiempo de vida del objeto
+class PhaseTimer {
+public:
+    explicit PhaseTimer(std::atomic<long long>& counter)
+        : counter(counter), start(std::chrono::steady_clock::now()) {}
+
+    ~PhaseTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        counter.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                          std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<long long>& counter;
+    std::chrono::steady_clock::time_point start;
+};
+
+// Los brazos de mutación del controlador se indexan igual que MutationType
+static_assert(static_cast<int>(ArmCrossover) == static_cast<int>(MutationCount),
+              "OperatorArm y MutationType deben coincidir");
+
+// Marca un cromosoma con el operador que lo tocó en esta generación
+void markChromosome(Chromosome& chrom, int arm, int epoch) {
+    if (chrom.operatorEpoch != epoch) {
+        chrom.operators = 0;
+        chrom.operatorEpoch = epoch;
+    }
+    chrom.operators |= operatorBit(arm);
+}
+
+// Marca todos los cromosomas de un individuo (la cruza y la copia los tocan todos)
+void markOperator(Individual& individual, int arm, int epoch) {
+    for (Chromosome& chrom : individual.chromosomes) {
+        markChromosome(chrom, arm, epoch);
+    }
+}
+
+} // namespace
+
 // ================= Constructor =================
 
 EvolutionaryAlgorithm::EvolutionaryAlgorithm(const ScenarioData& scenario,
                                              const QVector<QString>& policyNames,
                                              int populationSize,
                                              float crossoverRate,
-                                             const QVector<float>& mutationRates)
-    : scenario(scenario),
+                                             const QVector<float>& mutationRates,
+                                             std::uint64_t seed)
+    : EvolutionaryAlgorithm(std::make_shared<const ScenarioData>(scenario),
+                            policyNames, populationSize, crossoverRate,
+                            mutationRates, seed) {
+}
+
+EvolutionaryAlgorithm::EvolutionaryAlgorithm(std::shared_ptr<const ScenarioData> scenario,
+                                             const QVector<QString>& policyNames,
+                                             int populationSize,
+                                             float crossoverRate,
+                                             const QVector<float>& mutationRates,
+                                             std::uint64_t seed)
+    : scenarioData(std::move(scenario)),
+    scenario(*scenarioData),
     policyNames(policyNames),
     populationSize(populationSize),
-    crossoverRate(crossoverRate),
-    rng(std::random_device{}()),
-    dist(0.0, 1.0) {
+    seed(seed),
+    dist(0.0, 1.0),
+    crossoverRate(crossoverRate) {
     if (mutationRates.size() != MutationCount) {
         throw std::runtime_error("Mutation rates size mismatch");
     }
     this->mutationRates = mutationRates;
+
+    // Sin semilla explícita se genera una, pero siempre se reporta para poder reproducir
+    if (this->seed == 0) {
+        std::random_device device;
+        this->seed = (static_cast<std::uint64_t>(device()) << 32) | device();
+    }
+    rng.reseed(this->seed);
+    qDebug() << "Semilla del algoritmo evolutivo:" << this->seed;
 }
 
 // ================= Inicialización =================
@@ -32,8 +98,7 @@ void EvolutionaryAlgorithm::initialize() {
 
     for (int i = 0; i < populationSize; ++i) {
         Individual ind(policyNames);
-        ind.initializeRandom(scenario.totalOperations, 1, scenario.numMachines,
-                             *reinterpret_cast<QRandomGenerator*>(&rng));
+        ind.initializeRandom(scenario.totalOperations, 1, scenario.numMachines, rng);
         evaluateIndividual(ind);
         population.append(ind);
     }
@@ -57,46 +122,749 @@ void EvolutionaryAlgorithm::initialize() {
         hyperTemp.append(hv);
     }
     qDebug() << "Inicializado";
-    hypervolumes.append(hyperTemp);
+    recordHypervolumes(hyperTemp);
+
+    // La ventana de rendimiento empieza con la población inicial ya evaluada
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        throughput.reset();
+    }
+    recordThroughput(false);
 }
 
 // ================= Generación =================
 
-void EvolutionaryAlgorithm::runGeneration() {
-    QVector<Individual> parents = selectParents(population);
-    QVector<Individual> offspring = uniformCrossoverPopulation(parents);
+bool EvolutionaryAlgorithm::runGeneration() {
+    if (control && !control->checkpoint()) {
+        return false;
+    }
+
+    // Las marcas de generaciones anteriores dejan de contar para el crédito
+    ++operatorEpoch;
+    for (std::atomic<long long>& count : operatorApplications) {
+        count.store(0, std::memory_order_relaxed);
+    }
+
+    bool completed = true;
+    if (pipelined && !deterministic) {
+        completed = runGenerationPipelined();
+    } else if (scheduler || deterministic) {
+        completed = runGenerationParallel();
+    } else {
+        completed = runGenerationSerial();
+    }
+
+    if (completed) {
+        assignOperatorCredit();
+        recordThroughput(true);
+    }
+    return completed;
+}
+
+bool EvolutionaryAlgorithm::runGenerationSerial() {
+    QVector<int> parentIndices;
+    {
+        PhaseTimer timer(phaseNs[PhaseSelection]);
+        parentIndices = selectParentIndices(population, population.size());
+    }
+
+    QVector<Individual> offspring;
+    {
+        PhaseTimer timer(phaseNs[PhaseCrossover]);
+        uniformCrossoverPopulation(population, parentIndices, offspring);
+    }
 
     evaluatePopulation(offspring);
 
     QVector<Individual> combined = population;
     combined += offspring;
 
-    applyMutations(combined);
-    fastNonDominatedSort(combined);
+    {
+        PhaseTimer timer(phaseNs[PhaseMutation]);
+        applyMutations(combined);
+    }
+    {
+        PhaseTimer timer(phaseNs[PhaseSorting]);
+        fastNonDominatedSort(combined);
+    }
+
+    QVector<int> survivorIndices;
+    {
+        PhaseTimer timer(phaseNs[PhaseSurvival]);
+        survivorIndices = selectParentIndices(combined, populationSize);
+    }
 
-    population.clear();
-    for (int i = 0; i < populationSize; ++i) {
-        population.append(tournamentSelection(combined));
+    // Último punto en que se puede abandonar sin tocar la población
+    if (control && !control->checkpoint()) {
+        return false;
+    }
+    {
+        PhaseTimer timer(phaseNs[PhaseSurvival]);
+        gatherSelected(combined, survivorIndices, population);
     }
 
     evaluatePopulation(population);
-    fastNonDominatedSort(population);
+    {
+        PhaseTimer timer(phaseNs[PhaseSorting]);
+        fastNonDominatedSort(population);
+    }
 
     QVector<double> hyperTemp;
-    for (int i=0; i<population[0].getNumChromosomes(); i++){
-        double hv = calculateHyperVolume(i, f1_max, f2_max);
-        hyperTemp.append(hv);
+    {
+        PhaseTimer timer(phaseNs[PhaseHypervolume]);
+        for (int i=0; i<population[0].getNumChromosomes(); i++){
+            double hv = calculateHyperVolume(i, f1_max, f2_max);
+            hyperTemp.append(hv);
+        }
     }
 
-    hypervolumes.append(hyperTemp);
+    recordHypervolumes(hyperTemp);
+    return true;
+}
+
+Generator<EvolutionProgress> EvolutionaryAlgorithm::evolve(int numGenerations, int sliceMs)
+{
+    RunBudget budget;
+    budget.maxGenerations = numGenerations;
+    return evolve(budget, sliceMs);
+}
+
+Generator<EvolutionProgress> EvolutionaryAlgorithm::evolve(RunBudget budget, int sliceMs)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Sin RunControl el tiempo se mide aquí (y no hay pausas que descontar)
+    RunControl localControl;
+    RunControl* clock = control ? control : &localControl;
+    clock->start(budget.maxSeconds);
+
+    const long long firstEvaluation = evaluationCount.load(std::memory_order_relaxed);
+    long long lastGenerationEvaluations = 0;
+
+    // Estancamiento: mejor hipervolumen de cada política y generaciones sin superarlo
+    QVector<double> bestHypervolume = hypervolumes.isEmpty() ? QVector<double>() : hypervolumes.last();
+    int generationsWithoutImprovement = 0;
+
+    int gen = 0;
+    StopReason reason = StopReason::None;
+
+    auto usedEvaluations = [&]() {
+        return evaluationCount.load(std::memory_order_relaxed) - firstEvaluation;
+    };
+
+    // Motivo para no empezar otra generación (None = seguir)
+    auto checkBudget = [&]() {
+        if (clock->timeExpired()) return StopReason::Time;
+        if (clock->stopRequested()) return StopReason::Cancelled;
+        if (budget.maxGenerations > 0 && gen >= budget.maxGenerations) return StopReason::Generations;
+        // Una generación no se corta a la mitad: se estima con lo que gastó la anterior
+        if (budget.maxEvaluations > 0
+            && usedEvaluations() + lastGenerationEvaluations > budget.maxEvaluations) {
+            return StopReason::Evaluations;
+        }
+        if (budget.stagnationGenerations > 0 && generationsWithoutImprovement >= budget.stagnationGenerations) {
+            return StopReason::Stagnation;
+        }
+        return StopReason::None;
+    };
+
+    auto updateStagnation = [&]() {
+        const QVector<double>& current = hypervolumes.last();
+        bool improved = bestHypervolume.size() != current.size();
+        if (improved) {
+            bestHypervolume = current;
+        }
+        for (int c = 0; c < current.size() && !improved; ++c) {
+            if (current[c] > bestHypervolume[c] * (1.0 + budget.stagnationTolerance)) {
+                improved = true;
+            }
+        }
+        for (int c = 0; c < current.size(); ++c) {
+            bestHypervolume[c] = std::max(bestHypervolume[c], current[c]);
+        }
+        generationsWithoutImprovement = improved ? 0 : generationsWithoutImprovement + 1;
+    };
+
+    // Parte consumida del límite más cercano a cumplirse
+    auto budgetFraction = [&]() {
+        double fraction = 0.0;
+        if (budget.maxGenerations > 0) {
+            fraction = std::max(fraction, double(gen) / budget.maxGenerations);
+        }
+        if (budget.maxEvaluations > 0) {
+            fraction = std::max(fraction, double(usedEvaluations()) / budget.maxEvaluations);
+        }
+        if (budget.maxSeconds > 0.0) {
+            fraction = std::max(fraction, clock->elapsedSeconds() / budget.maxSeconds);
+        }
+        if (budget.stagnationGenerations > 0) {
+            fraction = std::max(fraction, double(generationsWithoutImprovement) / budget.stagnationGenerations);
+        }
+        return std::min(1.0, fraction);
+    };
+
+    while (reason == StopReason::None) {
+        const Clock::time_point sliceEnd = Clock::now() + std::chrono::milliseconds(sliceMs);
+        do {
+            const long long before = evaluationCount.load(std::memory_order_relaxed);
+            if (!runGeneration()) {
+                // Generación abandonada: la población quedó como en la anterior
+                reason = clock->timeExpired() ? StopReason::Time : StopReason::Cancelled;
+                break;
+            }
+            lastGenerationEvaluations = evaluationCount.load(std::memory_order_relaxed) - before;
+            ++gen;
+            updateStagnation();
+            reason = checkBudget();
+        } while (reason == StopReason::None && sliceMs > 0 && Clock::now() < sliceEnd);
+
+        // ETA: el límite que, al ritmo de la ventana actual, se cumpla primero
+        SolverStats stats = getSolverStats();
+        double eta = -1.0;
+        auto consider = [&eta](double seconds) {
+            if (seconds >= 0.0 && (eta < 0.0 || seconds < eta)) eta = seconds;
+        };
+        if (budget.maxSeconds > 0.0) {
+            consider(std::max(0.0, budget.maxSeconds - clock->elapsedSeconds()));
+        }
+        if (budget.maxGenerations > 0 && stats.generationsPerSecond > 0.0) {
+            consider(std::max(0, budget.maxGenerations - gen) / stats.generationsPerSecond);
+        }
+        if (budget.maxEvaluations > 0 && stats.evaluationsPerSecond > 0.0) {
+            consider(std::max(0LL, budget.maxEvaluations - usedEvaluations()) / stats.evaluationsPerSecond);
+        }
+        const double fraction = reason == StopReason::None ? budgetFraction() : 1.0;
+        if (reason != StopReason::None) {
+            eta = 0.0;
+        }
+        {
+            std::lock_guard<std::mutex> lock(statsMutex);
+            lastEtaSeconds = eta;
+            lastBudgetFraction = fraction;
+        }
+        stats.etaSeconds = eta;
+        stats.budgetFraction = fraction;
+
+        EvolutionProgress progress;
+        progress.generation = gen;
+        progress.totalGenerations = budget.maxGenerations;
+        progress.evaluations = usedEvaluations();
+        progress.elapsedSeconds = clock->elapsedSeconds();
+        progress.budgetFraction = fraction;
+        progress.stats = stats;
+        progress.hypervolumes = hypervolumes.last();
+        progress.snapshot = population;
+        progress.finished = reason != StopReason::None;
+        progress.stopReason = reason;
+        co_yield progress;
+    }
+}
+
+// Misma secuencia de fases que runGeneration(), expresada como grafo de tareas.
+// Los chunks dependen solo de chunkSize (no del número de hilos); en modo
+// determinista el azar se liga a cada elemento y tampoco depende de chunkSize.
+bool EvolutionaryAlgorithm::runGenerationParallel() {
+    const int numChromosomes = policyNames.size();
+    const int numParents = population.size();
+    const int numPairs = (numParents + 1) / 2;
+    const int numOffspring = numPairs * 2;
+    const int numCombined = numParents + numOffspring;
+    const int pairGrain = std::max(1, chunkSize / 2);
+
+    auto chunkCount = [](int n, int grain) { return (n + grain - 1) / grain; };
+
+    // Un flujo aleatorio por chunk, separado del flujo del motor en orden fijo
+    auto splitStreams = [this](int count) {
+        QVector<Rng> streams;
+        streams.reserve(count);
+        for (int i = 0; i < count; ++i) streams.append(rng.split());
+        return streams;
+    };
+    QVector<Rng> selectionStreams, crossoverStreams, mutationStreams, survivorStreams;
+    std::uint64_t generationKey = 0;
+    if (deterministic) {
+        generationKey = rng();
+    } else {
+        selectionStreams = splitStreams(chunkCount(numParents, chunkSize));
+        crossoverStreams = splitStreams(chunkCount(numPairs, pairGrain));
+        mutationStreams = splitStreams(chunkCount(numCombined, chunkSize));
+        survivorStreams = splitStreams(chunkCount(populationSize, chunkSize));
+    }
+
+    // Fases del modo determinista (segundo componente de la clave de cada flujo)
+    enum StreamPhase { SelectionPhase = 1, CrossoverPhase, MutationPhase, SurvivalPhase };
+    auto itemStream = [generationKey](StreamPhase phase, int index) {
+        return Rng::keyed(generationKey, phase, static_cast<std::uint64_t>(index));
+    };
+
+    // Sin planificador (solo en modo determinista) el grafo corre en este hilo
+    std::unique_ptr<TaskScheduler> inlineScheduler;
+    TaskScheduler* executor = scheduler;
+    if (!executor) {
+        inlineScheduler = std::make_unique<TaskScheduler>(1);
+        executor = inlineScheduler.get();
+    }
+
+    // Todo el almacenamiento se reserva antes para que las tareas solo escriban en él
+    // (y nadie desacople un contenedor compartido de forma concurrente)
+    population.detach();
+    QVector<int> parentIndices(numParents * numChromosomes);
+    QVector<int> survivorIndices(populationSize * numChromosomes);
+    QVector<Individual> offspring(numOffspring, Individual(policyNames));
+    QVector<Individual> survivors(populationSize, Individual(policyNames));
+    QVector<Individual> combined;
+    QVector<double> hyperTemp(numChromosomes);
+
+    Rng* selectionRng = selectionStreams.data();
+    Rng* crossoverRng = crossoverStreams.data();
+    Rng* mutationRng = mutationStreams.data();
+    Rng* survivorRng = survivorStreams.data();
+    Individual* offspringData = offspring.data();
+    Individual* survivorData = survivors.data();
+    Individual* combinedData = nullptr;
+    Individual* populationData = nullptr;
+    int* parentData = parentIndices.data();
+    int* survivorIndexData = survivorIndices.data();
+    double* hvData = hyperTemp.data();
+
+    // Parada/pausa: cada chunk de las fases 1-6 pasa por el punto de control; si
+    // se pide detener, los chunks restantes no hacen nada y la población no se toca
+    std::atomic<bool> abandoned{false};
+    auto keepGoing = [&]() {
+        if (abandoned.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        if (control && !control->checkpoint()) {
+            abandoned.store(true, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    };
+
+    TaskGraph graph;
+
+    // 1) Selección de padres
+    QVector<int> selection = graph.addParallelFor(0, numParents, chunkSize,
+        [&](int begin, int end, int chunk, int) {
+            if (!keepGoing()) return;
+            PhaseTimer timer(phaseNs[PhaseSelection]);
+            for (int i = begin; i < end; ++i) {
+                if (deterministic) {
+                    Rng stream = itemStream(SelectionPhase, i);
+                    tournamentSelection(population, parentData + i * numChromosomes, stream);
+                } else {
+                    tournamentSelection(population, parentData + i * numChromosomes,
+                                        selectionRng[chunk]);
+                }
+            }
+        });
+    int selected = graph.addJoin(selection);
+
+    // 2) Cruza y 3) evaluación de cada chunk de hijos en cuanto está listo
+    QVector<int> crossover = graph.addParallelFor(0, numPairs, pairGrain,
+        [&](int begin, int end, int chunk, int) {
+            if (!keepGoing()) return;
+            PhaseTimer timer(phaseNs[PhaseCrossover]);
+            if (deterministic) {
+                for (int p = begin; p < end; ++p) {
+                    Rng stream = itemStream(CrossoverPhase, p);
+                    crossoverPairs(population, parentIndices, offspringData, p, p + 1, stream);
+                }
+            } else {
+                crossoverPairs(population, parentIndices, offspringData, begin, end,
+                               crossoverRng[chunk]);
+            }
+        }, {selected});
+
+    QVector<int> evaluated;
+    for (int k = 0; k < crossover.size(); ++k) {
+        const int begin = 2 * k * pairGrain;
+        const int end = std::min(numOffspring, begin + 2 * pairGrain);
+        evaluated.append(graph.addTask([&, begin, end](int) {
+            if (!keepGoing()) return;
+            for (int i = begin; i < end; ++i) evaluateIndividual(offspringData[i]);
+        }, {crossover[k]}));
+    }
+
+    // 4) Población combinada y mutación
+    int combine = graph.addTask([&](int) {
+        if (!keepGoing()) return;
+        PhaseTimer timer(phaseNs[PhaseSurvival]);
+        combined = population;
+        combined += offspring;
+        combinedData = combined.data();
+    }, evaluated);
+
+    QVector<int> mutation = graph.addParallelFor(0, numCombined, chunkSize,
+        [&](int begin, int end, int chunk, int) {
+            if (!keepGoing()) return;
+            PhaseTimer timer(phaseNs[PhaseMutation]);
+            if (deterministic) {
+                for (int i = begin; i < end; ++i) {
+                    Rng stream = itemStream(MutationPhase, i);
+                    mutateRange(combinedData + i, 1, stream);
+                }
+            } else {
+                mutateRange(combinedData + begin, end - begin, mutationRng[chunk]);
+            }
+        }, {combine});
+
+    // 5) Ordenamiento (serial: la población aún comparte datos con 'combined')
+    int sorted = graph.addTask([&](int) {
+        if (!keepGoing()) return;
+        PhaseTimer timer(phaseNs[PhaseSorting]);
+        fastNonDominatedSort(combined);
+    }, mutation);
+
+    // 6) Supervivientes: torneo y copia de genes en el mismo chunk
+    QVector<int> survival = graph.addParallelFor(0, populationSize, chunkSize,
+        [&](int begin, int end, int chunk, int) {
+            if (!keepGoing()) return;
+            PhaseTimer timer(phaseNs[PhaseSurvival]);
+            for (int i = begin; i < end; ++i) {
+                int* winners = survivorIndexData + i * numChromosomes;
+                if (deterministic) {
+                    Rng stream = itemStream(SurvivalPhase, i);
+                    tournamentSelection(combined, winners, stream);
+                } else {
+                    tournamentSelection(combined, winners, survivorRng[chunk]);
+                }
+                for (int c = 0; c < numChromosomes; ++c) {
+                    const Chromosome& winner = combinedData[winners[c]].chromosomes[c];
+                    Chromosome& survivor = survivorData[i].chromosomes[c];
+                    survivor.genes = winner.genes;
+                    survivor.operators = winner.operators;
+                    survivor.operatorEpoch = winner.operatorEpoch;
+                }
+            }
+        }, {sorted});
+
+    // A partir del intercambio la generación siempre se completa
+    int replaced = graph.addTask([&](int) {
+        if (abandoned.load(std::memory_order_relaxed)) return;
+        population.swap(survivors);
+        populationData = population.data();
+    }, survival);
+
+    // 7) Evaluación de la nueva población
+    QVector<int> reevaluated = graph.addParallelFor(0, populationSize, chunkSize,
+        [&](int begin, int end, int, int) {
+            if (abandoned.load(std::memory_order_relaxed)) return;
+            for (int i = begin; i < end; ++i) evaluateIndividual(populationData[i]);
+        }, {replaced});
+    int ready = graph.addJoin(reevaluated);
+
+    // 8) Ordenamiento y 9) hipervolumen, ambos por política
+    for (int c = 0; c < numChromosomes; ++c) {
+        int sortTask = graph.addTask([this, c, &abandoned](int) {
+            if (abandoned.load(std::memory_order_relaxed)) return;
+            PhaseTimer timer(phaseNs[PhaseSorting]);
+            sortChromosome(population, c);
+        }, {ready});
+        graph.addTask([this, c, hvData, &abandoned](int) {
+            if (abandoned.load(std::memory_order_relaxed)) return;
+            PhaseTimer timer(phaseNs[PhaseHypervolume]);
+            hvData[c] = calculateHyperVolume(c, f1_max, f2_max);
+        }, {sortTask});
+    }
+
+    executor->run(graph);
+
+    if (abandoned.load()) {
+        return false;
+    }
+    recordHypervolumes(hyperTemp);
+    return true;
+}
+
+// El productor es una cadena de tareas (una por chunk de parejas, en orden y con
+// el flujo del motor) que selecciona, cruza y muta; cada chunk se evalúa en su
+// propia tarea en cuanto sale, mientras el productor sigue con el siguiente.
+bool EvolutionaryAlgorithm::runGenerationPipelined() {
+    const int numChromosomes = policyNames.size();
+    const int numParents = population.size();
+    const int numPairs = (numParents + 1) / 2;
+    const int numOffspring = numPairs * 2;
+    const int pairGrain = std::max(1, chunkSize / 2);
+
+    // Sin planificador la cadena corre en este hilo (sin solapamiento)
+    std::unique_ptr<TaskScheduler> inlineScheduler;
+    TaskScheduler* executor = scheduler;
+    if (!executor) {
+        inlineScheduler = std::make_unique<TaskScheduler>(1);
+        executor = inlineScheduler.get();
+    }
+
+    population.detach();
+    QVector<int> parentIndices(numParents * numChromosomes);
+    QVector<Individual> offspring(numOffspring, Individual(policyNames));
+    Individual* offspringData = offspring.data();
+    int* parentData = parentIndices.data();
+
+    // Parada/pausa: cada eslabón del productor pasa por el punto de control; si se
+    // pide detener, el resto de la cadena no hace nada y la población no se toca
+    std::atomic<bool> abandoned{false};
+
+    TaskGraph graph;
+    int previous = -1;
+    for (int pairBegin = 0; pairBegin < numPairs; pairBegin += pairGrain) {
+        const int pairEnd = std::min(numPairs, pairBegin + pairGrain);
+
+        int produced = graph.addTask([&, pairBegin, pairEnd](int) {
+            if (abandoned.load(std::memory_order_relaxed)) return;
+            if (control && !control->checkpoint()) {
+                abandoned.store(true, std::memory_order_relaxed);
+                return;
+            }
+
+            // Padres de estas parejas (la última pareja impar reutiliza al padre 0)
+            {
+                PhaseTimer timer(phaseNs[PhaseSelection]);
+                for (int i = 2 * pairBegin; i < std::min(2 * pairEnd, numParents); ++i) {
+                    tournamentSelection(population, parentData + i * numChromosomes, rng);
+                }
+            }
+            {
+                PhaseTimer timer(phaseNs[PhaseCrossover]);
+                crossoverPairs(population, parentIndices, offspringData, pairBegin, pairEnd, rng);
+            }
+            {
+                PhaseTimer timer(phaseNs[PhaseMutation]);
+                mutateRange(offspringData + 2 * pairBegin, 2 * (pairEnd - pairBegin), rng);
+            }
+        }, previous < 0 ? QVector<int>() : QVector<int>{previous});
+
+        graph.addTask([&, pairBegin, pairEnd](int) {
+            if (abandoned.load(std::memory_order_relaxed)) return;
+            for (int i = 2 * pairBegin; i < 2 * pairEnd; ++i) {
+                evaluateIndividual(offspringData[i]);
+            }
+        }, {produced});
+
+        previous = produced;
+    }
+
+    executor->run(graph);
+    if (abandoned.load()) {
+        return false;
+    }
+
+    // Todos los chunks evaluados: ordenamiento y supervivencia
+    QVector<Individual> combined = population;
+    combined += offspring;
+    {
+        PhaseTimer timer(phaseNs[PhaseSorting]);
+        fastNonDominatedSort(combined);
+    }
+
+    {
+        PhaseTimer timer(phaseNs[PhaseSurvival]);
+        QVector<int> survivorIndices = selectParentIndices(combined, populationSize);
+
+        // Cada política se evalúa por separado, así que copiar el cromosoma completo
+        // (genes + aptitud) deja al super-individuo ya evaluado
+        QVector<Individual> survivors;
+        survivors.reserve(populationSize);
+        for (int i = 0; i < populationSize; ++i) {
+            Individual survivor(policyNames);
+            const int* winners = survivorIndices.constData() + i * numChromosomes;
+            for (int c = 0; c < numChromosomes; ++c) {
+                survivor.chromosomes[c] = combined[winners[c]].chromosomes[c];
+            }
+            survivors.append(survivor);
+        }
+        population = survivors;
+    }
+    {
+        PhaseTimer timer(phaseNs[PhaseSorting]);
+        fastNonDominatedSort(population);
+    }
+
+    QVector<double> hyperTemp;
+    {
+        PhaseTimer timer(phaseNs[PhaseHypervolume]);
+        for (int i = 0; i < numChromosomes; i++) {
+            hyperTemp.append(calculateHyperVolume(i, f1_max, f2_max));
+        }
+    }
+    recordHypervolumes(hyperTemp);
+    return true;
+}
+
+// Los hilos nunca esperan a una generación completa: leen la instantánea publicada
+// más reciente y entregan sus hijos a un buffer; quien consigue el candado de
+// supervivencia integra el lote y publica la siguiente instantánea.
+void EvolutionaryAlgorithm::runSteadyState(long long numEvaluations, int numWorkers, int hvInterval)
+{
+    using Snapshot = std::shared_ptr<const QVector<Individual>>;
+
+    const int numChromosomes = policyNames.size();
+    if (numWorkers <= 0) {
+        numWorkers = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    hvInterval = std::max(1, hvInterval);
+
+    // Lote de supervivencia: suficiente para amortizar el ordenamiento sin
+    // que la instantánea quede demasiado desfasada
+    const int batchSize = std::max(2, std::min(populationSize / 2, 2 * numWorkers));
+
+    Snapshot snapshot = std::make_shared<const QVector<Individual>>(population);
+    std::mutex snapshotMutex;                   // Protege solo el intercambio del puntero
+
+    QVector<Individual> pending;                // Hijos evaluados aún no integrados
+    std::mutex pendingMutex;
+    std::mutex survivalMutex;                   // Un solo hilo aplica supervivencia a la vez
+
+    std::atomic<long long> budget{numEvaluations};
+
+    // Reserva dos evaluaciones (una si es lo único que queda); 0 = presupuesto agotado
+    auto reserve = [&budget]() -> int {
+        long long left = budget.load(std::memory_order_relaxed);
+        while (left > 0) {
+            const int take = left >= 2 ? 2 : 1;
+            if (budget.compare_exchange_weak(left, left - take, std::memory_order_relaxed)) {
+                return take;
+            }
+        }
+        return 0;
+    };
+
+    // Evaluaciones ya integradas a la población (los hijos en 'pending' no cuentan);
+    // solo se tocan con survivalMutex tomado o tras unir los hilos
+    long long merged = evaluationCount.load();
+    long long recordedAt = merged;              // Evaluaciones integradas en el último registro
+    long long nextHvAt = merged + hvInterval;
+
+    auto recordFront = [&]() {
+        QVector<double> hyperTemp;
+        for (int i = 0; i < numChromosomes; i++) {
+            hyperTemp.append(calculateHyperVolume(i, f1_max, f2_max));
+        }
+        recordHypervolumes(hyperTemp);
+        recordedAt = merged;
+    };
+
+    // Integra los hijos pendientes (con survivalMutex tomado)
+    auto survive = [&](bool force) {
+        QVector<Individual> batch;
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex);
+            if (pending.isEmpty() || (!force && pending.size() < batchSize)) {
+                return;
+            }
+            batch.swap(pending);
+        }
+        merged += batch.size();
+
+        QVector<Individual> combined = population;
+        combined += batch;
+        fastNonDominatedSort(combined);
+
+        population = truncateByRank(combined, populationSize);
+        fastNonDominatedSort(population);
+
+        {
+            std::lock_guard<std::mutex> lock(snapshotMutex);
+            snapshot = std::make_shared<const QVector<Individual>>(population);
+        }
+
+        // Un lote puede cruzar varias marcas: un solo registro y se salta a la siguiente
+        if (merged >= nextHvAt) {
+            recordFront();
+            recordThroughput(false);
+            nextHvAt += ((merged - nextHvAt) / hvInterval + 1) * hvInterval;
+        }
+    };
+
+    auto worker = [&](Rng stream) {
+        QVector<int> parentIndices(2 * numChromosomes);
+        Individual children[2] = { Individual(policyNames), Individual(policyNames) };
+
+        while (const int count = reserve()) {
+            Snapshot current;
+            {
+                std::lock_guard<std::mutex> lock(snapshotMutex);
+                current = snapshot;
+            }
+
+            tournamentSelection(*current, parentIndices.data(), stream);
+            tournamentSelection(*current, parentIndices.data() + numChromosomes, stream);
+
+            // Con un presupuesto impar el último cruce entrega un solo hijo
+            crossoverPairs(*current, parentIndices, children, 0, 1, stream);
+            mutateRange(children, count, stream);
+            for (int k = 0; k < count; ++k) {
+                evaluateIndividual(children[k]);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(pendingMutex);
+                for (int k = 0; k < count; ++k) {
+                    pending.append(children[k]);
+                }
+            }
+
+            if (survivalMutex.try_lock()) {
+                survive(false);
+                survivalMutex.unlock();
+            }
+        }
+    };
+
+    // Flujos separados del flujo del motor en orden fijo (uno por hilo)
+    std::vector<std::thread> threads;
+    threads.reserve(numWorkers);
+    for (int w = 0; w < numWorkers; ++w) {
+        threads.emplace_back(worker, rng.split());
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Restos del último lote y registro final
+    survive(true);
+    if (merged > recordedAt) {
+        recordFront();
+    }
+}
+
+QVector<Individual> EvolutionaryAlgorithm::truncateByRank(const QVector<Individual>& pop, int count) const
+{
+    const int numChromosomes = policyNames.size();
+    count = std::min(count, static_cast<int>(pop.size()));
+
+    QVector<Individual> survivors(count, Individual(policyNames));
+    QVector<int> order(pop.size());
+
+    for (int c = 0; c < numChromosomes; c++) {
+        for (int i = 0; i < order.size(); i++) {
+            order[i] = i;
+        }
+
+        std::partial_sort(order.begin(), order.begin() + count, order.end(),
+                          [&pop, c](int a, int b) {
+                              const Chromosome& A = pop[a].chromosomes[c];
+                              const Chromosome& B = pop[b].chromosomes[c];
+                              if (A.domLevel != B.domLevel) return A.domLevel < B.domLevel;
+                              return A.crowdingDistance > B.crowdingDistance;
+                          });
+
+        for (int i = 0; i < count; i++) {
+            survivors[i].chromosomes[c] = pop[order[i]].chromosomes[c];
+        }
+    }
+
+    return survivors;
 }
 
 // ================= Evaluación =================
 
 void EvolutionaryAlgorithm::evaluateIndividual(Individual& individual) {
+    PhaseTimer timer(phaseNs[PhaseEvaluation]);
     for (Chromosome& c : individual.chromosomes) {
         evaluateChromosome(c);
     }
+    evaluationCount.fetch_add(1, std::memory_order_relaxed);
 }
 
 void EvolutionaryAlgorithm::evaluatePopulation(QVector<Individual>& pop) {
@@ -150,11 +918,17 @@ double EvolutionaryAlgorithm::calculateHyperVolume(int chromosomeIndex,
 // ================= NSGA-II =================
 
 void EvolutionaryAlgorithm::fastNonDominatedSort(QVector<Individual>& pop) {
-    for (int c = 0; c < population[0].getNumChromosomes();c++){
+    for (int c = 0; c < pop[0].getNumChromosomes();c++){
+        sortChromosome(pop, c);
+    }
+}
+
+void EvolutionaryAlgorithm::sortChromosome(QVector<Individual>& pop, int c) {
+    {
         int rank = 0;
         QVector<Individual*> dominatedIndividuals;
         QVector<Individual*> dominatedIndividualsTemp;
-        for (auto& ind : population) {
+        for (auto& ind : pop) {
             dominatedIndividuals.push_back(&ind);
         }
         while (!dominatedIndividuals.empty()) {
@@ -190,7 +964,7 @@ void EvolutionaryAlgorithm::fastNonDominatedSort(QVector<Individual>& pop) {
         }
         for (int r = 1; r <= rank; r++) {
             QVector<Individual*> front;
-            for (auto& ind : population) {
+            for (auto& ind : pop) {
                 if (ind.chromosomes[c].domLevel == r) {
                     front.push_back(&ind);
                 }
@@ -244,8 +1018,10 @@ void EvolutionaryAlgorithm::calculateCrowdingDistance(QVector<Individual*>& fron
 
 // ================= Selección =================
 
-Individual EvolutionaryAlgorithm::tournamentSelection(
-    const QVector<Individual>& pop
+void EvolutionaryAlgorithm::tournamentSelection(
+    const QVector<Individual>& pop,
+    int* winners,
+    Rng& rng
     )
 {
     std::uniform_int_distribution<int> dist(0, pop.size() - 1);
@@ -256,132 +1032,187 @@ Individual EvolutionaryAlgorithm::tournamentSelection(
     const Individual& A = pop[index1];
     const Individual& B = pop[index2];
 
-    Individual superIndividual(policyNames);
-
-    // Asegurar estructura
-    superIndividual.chromosomes.resize(A.getNumChromosomes());
-
     for (int c = 0; c < A.getNumChromosomes(); c++) {
 
-        const Chromosome* winner = nullptr;
-
         if (A.chromosomes[c].domLevel < B.chromosomes[c].domLevel) {
-            winner = &A.chromosomes[c];
+            winners[c] = index1;
         }
         else if (B.chromosomes[c].domLevel < A.chromosomes[c].domLevel) {
-            winner = &B.chromosomes[c];
+            winners[c] = index2;
         }
         else {
-            winner = (A.chromosomes[c].crowdingDistance >
-                      B.chromosomes[c].crowdingDistance)
-                         ? &A.chromosomes[c]
-                         : &B.chromosomes[c];
+            winners[c] = (A.chromosomes[c].crowdingDistance >
+                          B.chromosomes[c].crowdingDistance)
+                             ? index1
+                             : index2;
         }
-
-        superIndividual.chromosomes[c].genes = winner->genes;
     }
-
-    return superIndividual;
 }
 
 
-QVector<Individual> EvolutionaryAlgorithm::selectParents(
-    const QVector<Individual>& pop
+QVector<int> EvolutionaryAlgorithm::selectParentIndices(
+    const QVector<Individual>& pop,
+    int count
     )
 {
-    QVector<Individual> parents;
-    parents.reserve(pop.size());
+    const int numChromosomes = policyNames.size();
+    QVector<int> indices(count * numChromosomes);
 
-    for (int i = 0; i < pop.size(); i++) {
-        parents.push_back(tournamentSelection(pop));
+    for (int i = 0; i < count; i++) {
+        tournamentSelection(pop, indices.data() + i * numChromosomes, rng);
     }
 
-    return parents;
+    return indices;
+}
+
+
+void EvolutionaryAlgorithm::gatherSelected(
+    const QVector<Individual>& source,
+    const QVector<int>& indices,
+    QVector<Individual>& dest
+    ) const
+{
+    const int numChromosomes = policyNames.size();
+    const int count = indices.size() / numChromosomes;
+
+    dest.clear();
+    dest.reserve(count);
+
+    for (int i = 0; i < count; i++) {
+        Individual selected(policyNames);
+        const int* winners = indices.constData() + i * numChromosomes;
+
+        for (int c = 0; c < numChromosomes; c++) {
+            // Copia implícita compartida: no se duplican genes hasta que se modifiquen
+            const Chromosome& winner = source[winners[c]].chromosomes[c];
+            selected.chromosomes[c].genes = winner.genes;
+            selected.chromosomes[c].operators = winner.operators;
+            selected.chromosomes[c].operatorEpoch = winner.operatorEpoch;
+        }
+
+        dest.append(selected);
+    }
 }
 
 
 // ================= Cruza =================
 
-QVector<Individual>
-EvolutionaryAlgorithm::uniformCrossoverPopulation(const QVector<Individual>& parents)
+void EvolutionaryAlgorithm::uniformCrossoverPopulation(
+    const QVector<Individual>& source,
+    const QVector<int>& parentIndices,
+    QVector<Individual>& offspring)
 {
-    if (parents.isEmpty()) {
-        return {};
+    const int numChromosomes = policyNames.size();
+    const int numParents = parentIndices.size() / numChromosomes;
+
+    offspring.clear();
+    if (numParents == 0) {
+        return;
     }
 
-    QVector<Individual> offspring;
-    offspring.reserve(parents.size());
+    // Igual que antes: si el número de padres es impar, el último se cruza con el primero
+    const int numPairs = (numParents + 1) / 2;
+    offspring = QVector<Individual>(numPairs * 2, Individual(policyNames));
+
+    crossoverPairs(source, parentIndices, offspring.data(), 0, numPairs, rng);
+}
+
+void EvolutionaryAlgorithm::crossoverPairs(
+    const QVector<Individual>& source,
+    const QVector<int>& parentIndices,
+    Individual* offspring,
+    int pairBegin,
+    int pairEnd,
+    Rng& rng) const
+{
+    const int numChromosomes = policyNames.size();
+    const int numParents = parentIndices.size() / numChromosomes;
+    const int geneCount = source[0].chromosomes[0].genes.size();
+
+    QVector<std::uint64_t> mask;                // Máscara de bits compartida por todos los cromosomas
+    mask.reserve(crossoverMaskWords(geneCount));
 
-    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    int crossedPairs = 0;
 
-    for (int i = 0; i < parents.size(); i += 2) {
+    for (int p = pairBegin; p < pairEnd; p++) {
 
-        const Individual& parent1 = parents[i];
-        const Individual& parent2 = parents[(i + 1) % parents.size()];
+        const int* parent1 = parentIndices.constData() + (2 * p) * numChromosomes;
+        const int* parent2 = parentIndices.constData() + ((2 * p + 1) % numParents) * numChromosomes;
 
-        Individual offspring1(policyNames);
-        Individual offspring2(policyNames);
+        Individual& offspring1 = offspring[2 * p];
+        Individual& offspring2 = offspring[2 * p + 1];
 
         // ===== UNIFORM CROSSOVER =====
-        if (dist(rng) < crossoverRate) {
-
-            int geneCount = parent1.chromosomes[0].genes.size();
-            int numChromosomes = parent1.getNumChromosomes();
-
-            for (int g = 0; g < geneCount; g++) {
-
-                bool fromParent1 = (dist(rng) < 0.5);
-
-                for (int c = 0; c < numChromosomes; c++) {
-                    if (fromParent1) {
-                        offspring1.chromosomes[c].genes.push_back(
-                            parent1.chromosomes[c].genes[g]);
-                        offspring2.chromosomes[c].genes.push_back(
-                            parent2.chromosomes[c].genes[g]);
-                    } else {
-                        offspring1.chromosomes[c].genes.push_back(
-                            parent2.chromosomes[c].genes[g]);
-                        offspring2.chromosomes[c].genes.push_back(
-                            parent1.chromosomes[c].genes[g]);
-                    }
-                }
+        const bool crossed = rng.uniform01() < crossoverRate;
+        if (crossed) {
+
+            fillCrossoverMask(mask, geneCount, rng);
+
+            for (int c = 0; c < numChromosomes; c++) {
+                QVector<int>& child1 = offspring1.chromosomes[c].genes;
+                QVector<int>& child2 = offspring2.chromosomes[c].genes;
+                child1.resize(geneCount);
+                child2.resize(geneCount);
+
+                blendCrossover(source[parent1[c]].chromosomes[c].genes.constData(),
+                               source[parent2[c]].chromosomes[c].genes.constData(),
+                               child1.data(), child2.data(),
+                               mask.constData(), geneCount);
             }
 
         } else {
-            // Sin cruce
-            offspring1 = parent1;
-            offspring2 = parent2;
+            // Sin cruce: los hijos son copias de los padres
+            for (int c = 0; c < numChromosomes; c++) {
+                offspring1.chromosomes[c].genes = source[parent1[c]].chromosomes[c].genes;
+                offspring2.chromosomes[c].genes = source[parent2[c]].chromosomes[c].genes;
+            }
         }
 
-        offspring.push_back(offspring1);
-        offspring.push_back(offspring2);
+        const int arm = crossed ? ArmCrossover : ArmCopy;
+        markOperator(offspring1, arm, operatorEpoch);
+        markOperator(offspring2, arm, operatorEpoch);
+        crossedPairs += crossed ? 1 : 0;
     }
 
-    return offspring;
+    // Cada pareja cuenta como dos aplicaciones (una por hijo)
+    const int pairs = std::max(0, pairEnd - pairBegin);
+    operatorApplications[ArmCrossover].fetch_add(2 * crossedPairs, std::memory_order_relaxed);
+    operatorApplications[ArmCopy].fetch_add(2 * (pairs - crossedPairs), std::memory_order_relaxed);
 }
 
 // ================= Mutación =================
 
 void EvolutionaryAlgorithm::applyMutations(QVector<Individual>& population)
 {
-    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    mutateRange(population.data(), population.size(), rng);
+}
 
-    for (Individual& individual : population) {
+void EvolutionaryAlgorithm::mutateRange(Individual* individuals, int count, Rng& rng) const
+{
+    // Un operador a la vez: primero se deciden en lote qué individuos mutan
+    // (costo ∝ número de mutaciones) y luego se aplica el núcleo solo a esos.
+    // Cada individuo sigue recibiendo los operadores en el mismo orden.
+    static const MutationKernel kernels[MutationCount] = {
+        kernelInterChromosome,
+        kernelReciprocalExchange,
+        kernelShift
+    };
 
-        mutationInterChromosome(
-            individual, rng,
-            mutationRates[InterChromosome], dist
-            );
+    QVector<int> selected;
+    QVector<GeneChange> changes;
 
-        mutationReciprocalExchange(
-            individual, rng,
-            mutationRates[ReciprocalExchange], dist
-            );
+    for (int op = 0; op < MutationCount; ++op) {
+        sampleBernoulliIndices(count, mutationRates[op], rng, selected);
 
-        mutationShift(
-            individual, rng,
-            mutationRates[Shift], dist
-            );
+        for (int i : selected) {
+            // Solo los cromosomas que el núcleo cambió reciben el crédito del operador
+            changes.clear();
+            kernels[op](individuals[i], rng, &changes);
+            for (const GeneChange& change : changes) {
+                markChromosome(individuals[i].chromosomes[change.chromosome], op, operatorEpoch);
+            }
+        }
+        operatorApplications[op].fetch_add(selected.size(), std::memory_order_relaxed);
     }
 }
 
@@ -453,7 +1284,9 @@ EvolutionaryAlgorithm::evaluateChromosome(Chromosome& chromosome) {
     QVector<JobState> jobStates(scenario.numJobs);
     QVector<OperationSchedule> schedule;
 
-    auto& mapping = scenario.chromosomeMapping[chromosome.policyName];
+    // value() en lugar de operator[]: el escenario es compartido y de solo lectura
+    const QVector<QPair<Job, Operation>> mapping =
+        scenario.chromosomeMapping.value(chromosome.policyName);
 
     for (int i = 0; i < chromosome.genes.size(); ++i) {
         int opId = mapping[i].second.id;
@@ -478,6 +1311,106 @@ EvolutionaryAlgorithm::evaluateChromosome(Chromosome& chromosome) {
     return schedule;
 }
 
+DecodedSchedule
+EvolutionaryAlgorithm::decodeSchedule(int policyId, const QVector<int>& genes) const {
+    QVector<MachineState> machines(scenario.numMachines);
+    QVector<JobState> jobStates(scenario.numJobs);
+
+    DecodedSchedule decoded;
+    decoded.numMachines = scenario.numMachines;
+    decoded.operations.reserve(genes.size());
+
+    const QVector<QPair<Job, Operation>> mapping =
+        scenario.chromosomeMapping.value(policyNames.value(policyId));
+
+    for (int i = 0; i < genes.size() && i < mapping.size(); ++i) {
+        const OperationSchedule op = scheduleOperation(mapping[i].second.id, mapping[i].first.id,
+                                                       genes[i] - 1, machines, jobStates);
+        decoded.operations.append({op.jobId, op.operationId, op.machineId, op.startTime, op.endTime});
+    }
+
+    for (const auto& m : machines) {
+        if (m.isActive) {
+            decoded.makespan = std::max(decoded.makespan, m.currentTime);
+            decoded.energy += m.totalEnergy;
+        }
+    }
+
+    return decoded;
+}
+
+// ================= Migración =================
+
+// Mejor (menor) nivel de dominancia del individuo entre todos sus cromosomas
+static int bestDomLevel(const Individual& ind)
+{
+    int best = std::numeric_limits<int>::max();
+    for (const Chromosome& chrom : ind.chromosomes) {
+        best = std::min(best, chrom.domLevel);
+    }
+    return best;
+}
+
+static double meanCrowding(const Individual& ind)
+{
+    double sum = 0.0;
+    for (const Chromosome& chrom : ind.chromosomes) {
+        sum += chrom.crowdingDistance;
+    }
+    return ind.chromosomes.isEmpty() ? 0.0 : sum / ind.chromosomes.size();
+}
+
+// true si A es mejor candidato a emigrar que B (rango menor, luego más diverso)
+static bool betterMigrant(const Individual& A, const Individual& B)
+{
+    int levelA = bestDomLevel(A);
+    int levelB = bestDomLevel(B);
+    if (levelA != levelB) return levelA < levelB;
+    return meanCrowding(A) > meanCrowding(B);
+}
+
+QVector<Individual> EvolutionaryAlgorithm::getEmigrants(int count) const
+{
+    QVector<int> order(population.size());
+    for (int i = 0; i < order.size(); ++i) order[i] = i;
+
+    count = std::min<int>(count, order.size());
+    std::partial_sort(order.begin(), order.begin() + count, order.end(),
+                      [this](int a, int b) {
+                          return betterMigrant(population[a], population[b]);
+                      });
+
+    QVector<Individual> emigrants;
+    emigrants.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        // Solo emigran soluciones no dominadas en al menos una política
+        if (bestDomLevel(population[order[i]]) != 1) break;
+        emigrants.append(population[order[i]]);
+    }
+    return emigrants;
+}
+
+void EvolutionaryAlgorithm::acceptImmigrants(const QVector<Individual>& immigrants)
+{
+    if (immigrants.isEmpty() || population.isEmpty()) return;
+
+    QVector<int> order(population.size());
+    for (int i = 0; i < order.size(); ++i) order[i] = i;
+
+    // Los peores quedan al final
+    std::sort(order.begin(), order.end(),
+              [this](int a, int b) {
+                  return betterMigrant(population[a], population[b]);
+              });
+
+    int count = std::min<int>(immigrants.size(), population.size());
+    for (int i = 0; i < count; ++i) {
+        population[order[order.size() - 1 - i]] = immigrants[i];
+    }
+
+    fastNonDominatedSort(population);
+}
+
 // ================= Setters =================
 
 void EvolutionaryAlgorithm::setMutationRates(const QVector<float>& rates)
@@ -494,6 +1427,121 @@ void EvolutionaryAlgorithm::setCrossoverRate(float rate)
     crossoverRate = rate;
 }
 
+const QVector<float>& EvolutionaryAlgorithm::getMutationRates() const
+{
+    return mutationRates;
+}
+
+float EvolutionaryAlgorithm::getCrossoverRate() const
+{
+    return crossoverRate;
+}
+
+void EvolutionaryAlgorithm::setOperatorRateController(OperatorRateController* controller)
+{
+    // Se parte de las tasas del controlador (pueden diferir de las recibidas por el piso pmin)
+    rateController = controller;
+    if (rateController) {
+        setMutationRates(rateController->mutationRates());
+        setCrossoverRate(rateController->crossoverRate());
+    }
+}
+
+const OperatorCredit& EvolutionaryAlgorithm::getOperatorCredit() const
+{
+    return lastCredit;
+}
+
+void EvolutionaryAlgorithm::assignOperatorCredit()
+{
+    OperatorCredit credit;
+    for (int arm = 0; arm < OperatorArmCount; ++arm) {
+        credit.applications[arm] = operatorApplications[arm].load(std::memory_order_relaxed);
+    }
+
+    // Un individuo completo en el primer frente vale 1, igual que una aplicación
+    const int numChromosomes = policyNames.size();
+    for (const Individual& ind : population) {
+        for (const Chromosome& chrom : ind.chromosomes) {
+            if (chrom.operatorEpoch != operatorEpoch || chrom.domLevel < 1) {
+                continue;
+            }
+            const double reward = 1.0 / (chrom.domLevel * numChromosomes);
+            for (int arm = 0; arm < OperatorArmCount; ++arm) {
+                if (chrom.operators & operatorBit(arm)) {
+                    credit.reward[arm] += reward;
+                }
+            }
+        }
+    }
+    lastCredit = credit;
+
+    if (rateController) {
+        rateController->update(credit);
+        setMutationRates(rateController->mutationRates());
+        setCrossoverRate(rateController->crossoverRate());
+    }
+}
+
+void EvolutionaryAlgorithm::setRandomStream(const Rng& stream)
+{
+    rng = stream;
+}
+
+std::uint64_t EvolutionaryAlgorithm::getSeed() const
+{
+    return seed;
+}
+
+void EvolutionaryAlgorithm::setTaskScheduler(TaskScheduler* scheduler, int chunkSize)
+{
+    this->scheduler = scheduler;
+    this->chunkSize = std::max(1, chunkSize);
+}
+
+void EvolutionaryAlgorithm::setPipelineEnabled(bool enabled)
+{
+    pipelined = enabled;
+}
+
+void EvolutionaryAlgorithm::setDeterministic(bool enabled)
+{
+    deterministic = enabled;
+}
+
+long long EvolutionaryAlgorithm::getEvaluationCount() const
+{
+    return evaluationCount.load(std::memory_order_relaxed);
+}
+
+void EvolutionaryAlgorithm::setRunControl(RunControl* control)
+{
+    this->control = control;
+}
+
+SolverStats EvolutionaryAlgorithm::getSolverStats() const
+{
+    std::lock_guard<std::mutex> lock(statsMutex);
+    SolverStats stats = throughput.stats();
+    stats.etaSeconds = lastEtaSeconds;
+    stats.budgetFraction = lastBudgetFraction;
+    return stats;
+}
+
+void EvolutionaryAlgorithm::recordThroughput(bool generationCompleted)
+{
+    std::array<long long, PhaseCount> phases;
+    for (int p = 0; p < PhaseCount; ++p) {
+        phases[p] = phaseNs[p].load(std::memory_order_relaxed);
+    }
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    if (generationCompleted) {
+        ++generationCount;
+    }
+    throughput.addSample(evaluationCount.load(std::memory_order_relaxed), generationCount, phases);
+}
+
 // ================= Getters =================
 
 const QVector<Individual>& EvolutionaryAlgorithm::getPopulation() const {
@@ -504,6 +1552,21 @@ const QVector<QVector<double>>& EvolutionaryAlgorithm::getHypervolumes() const {
     return hypervolumes;
 }
 
+const QVector<HypervolumeStats>& EvolutionaryAlgorithm::getHypervolumeStats() const {
+    return hypervolumeStats;
+}
+
+void EvolutionaryAlgorithm::recordHypervolumes(const QVector<double>& values) {
+    hypervolumes.append(values);
+
+    if (hypervolumeStats.size() < values.size()) {
+        hypervolumeStats.resize(values.size());
+    }
+    for (int c = 0; c < values.size(); ++c) {
+        hypervolumeStats[c].add(values[c]);
+    }
+}
+
 Individual EvolutionaryAlgorithm::getBestMakespan() const
 {
     double bestMakespan = std::numeric_limits<double>::max();
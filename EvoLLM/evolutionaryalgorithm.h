@@ -2,10 +2,22 @@
 #define EVOLUTIONARY_ALGORITHM_H
 
 #include <QVector>
-#include <random>                   // Para el generador Mersenne Twister (std::mt19937)
+#include <random>                   // Distribuciones aleatorias
+#include <cstdint>
+#include <memory>
+#include <atomic>
+#include <array>
+#include <mutex>
+#include <algorithm>
+#include "rng.h"                    // Generador xoshiro256++ con flujos independientes
 #include "Individual.h"             // Contiene la clase Individual (varios cromosomas)
 #include "ScenarioData.h"           // Información del problema (jobs, máquinas, tiempos...)
 #include "ScheduleTypes.h"          // Definiciones como OperationSchedule, MachineState, etc.
+#include "taskscheduler.h"          // Planificador con robo de trabajo (fases en paralelo)
+#include "generator.h"              // Generador basado en corrutinas (evolve())
+#include "runcontrol.h"             // Presupuesto de la corrida y parada/pausa cooperativas
+#include "solverstats.h"            // Rendimiento en ventana móvil y tiempo por fase
+#include "operatorratecontroller.h" // Crédito por operador y tasas adaptativas
 
 enum MutationType {
     InterChromosome = 0,        // Mutación entre diferentes cromosomas/políticas
@@ -14,6 +26,54 @@ enum MutationType {
     MutationCount               // Número total de tipos de mutación (usado como límite)
 };
 
+/**
+ * @brief Estadísticas acumuladas del hipervolumen de una política
+ *
+ * Se actualizan en O(1) con cada generación registrada (media y varianza con el
+ * algoritmo de Welford), así que consultarlas no recorre el historial.
+ */
+struct HypervolumeStats {
+    long long count = 0;
+    double min = 0.0;
+    double max = 0.0;
+    double mean = 0.0;
+    double m2 = 0.0;                        // Suma de cuadrados de las desviaciones
+    double last = 0.0;                      // Último valor registrado
+
+    void add(double value) {
+        if (count == 0) {
+            min = max = value;
+        } else {
+            min = std::min(min, value);
+            max = std::max(max, value);
+        }
+        count++;
+        const double delta = value - mean;
+        mean += delta / count;
+        m2 += delta * (value - mean);
+        last = value;
+    }
+
+    /** @brief Varianza muestral (0 con menos de dos valores) */
+    double variance() const { return count > 1 ? m2 / (count - 1) : 0.0; }
+};
+
+/**
+ * @brief Estado que entrega evolve() cada vez que cede el control
+ */
+struct EvolutionProgress {
+    int generation = 0;                     // Generaciones completadas en esta corrida
+    int totalGenerations = 0;               // Límite de generaciones (0 = sin límite)
+    long long evaluations = 0;              // Evaluaciones hechas en esta corrida
+    double elapsedSeconds = 0.0;            // Sin contar pausas
+    double budgetFraction = 0.0;            // Parte consumida del presupuesto más cercano a agotarse [0, 1]
+    QVector<double> hypervolumes;           // Hipervolumen actual de cada política
+    QVector<Individual> snapshot;           // Población actual (copia implícitamente compartida)
+    bool finished = false;                  // true en la última entrega
+    StopReason stopReason = StopReason::None;
+    SolverStats stats;                      // Rendimiento reciente y ETA al presupuesto
+};
+
 /**
  * @brief Implementación de un algoritmo evolutivo multiobjetivo (NSGA-II like)
  * para optimización de scheduling con dos objetivos: Makespan y Consumo Energético
@@ -30,27 +90,192 @@ public:
      * @param populationSize Tamaño de la población
      * @param crossoverRate Probabilidad inicial de cruce (se puede adaptar)
      * @param mutationRates Probabilidades iniciales de cada tipo de mutación
+     * @param seed Semilla de la ejecución (0 = se genera una aleatoria y se reporta)
      */
     EvolutionaryAlgorithm(const ScenarioData& scenario,
                          const QVector<QString>& policyNames,
                          int populationSize,
                          float crossoverRate,
-                         const QVector<float>& mutationRates);
+                         const QVector<float>& mutationRates,
+                         std::uint64_t seed = 0);
+
+    /**
+     * @brief Igual que el anterior, pero compartiendo un escenario inmutable
+     * (varias instancias/hilos pueden usar el mismo ScenarioData sin copiarlo)
+     */
+    EvolutionaryAlgorithm(std::shared_ptr<const ScenarioData> scenario,
+                         const QVector<QString>& policyNames,
+                         int populationSize,
+                         float crossoverRate,
+                         const QVector<float>& mutationRates,
+                         std::uint64_t seed = 0);
 
     // Inicialización
     /** Genera la población inicial con cromosomas aleatorios para cada política */
     void initialize();
 
-    /** Ejecuta una generación completa: evaluación → ordenamiento → selección → cruce → mutación */
-    void runGeneration();
+    /**
+     * Ejecuta una generación completa: evaluación → ordenamiento → selección → cruce → mutación
+     * @return false si el RunControl pidió detenerse y la generación se abandonó
+     *         (la población queda intacta, tal como terminó la generación anterior)
+     */
+    bool runGeneration();
+
+    /**
+     * @brief Corrida como corrutina: ejecuta generaciones y cede el control entre porciones
+     *
+     * No usa hilos propios: quien consume el generador (la interfaz, desde el bucle
+     * de eventos, o un driver sin interfaz) decide cuándo reanudar con next().
+     * Destruir el generador cancela la corrida entre dos generaciones.
+     * Requiere haber llamado antes a initialize().
+     *
+     * @param numGenerations Generaciones a ejecutar
+     * @param sliceMs 0 = cede después de cada generación; > 0 = encadena generaciones
+     *                hasta agotar la porción de tiempo y entonces cede
+     */
+    Generator<EvolutionProgress> evolve(int numGenerations, int sliceMs = 0);
+
+    /**
+     * @brief Igual que evolve(int), pero termina con el primer límite del presupuesto
+     * que se cumpla (generaciones, evaluaciones, tiempo o estancamiento) o cuando el
+     * RunControl pide detenerse. La última entrega lleva finished = true y el motivo.
+     * Si hay RunControl, el límite de tiempo se arma en él al empezar.
+     */
+    Generator<EvolutionProgress> evolve(RunBudget budget, int sliceMs = 0);
 
     // Setters (útiles para adaptación dinámica de parámetros)
     void setMutationRates(const QVector<float>& rates);
     void setCrossoverRate(float rate);
 
+    /** @brief Parámetros vigentes (los cambian los setters y el controlador adaptativo) */
+    const QVector<float>& getMutationRates() const;
+    float getCrossoverRate() const;
+
+    /**
+     * @brief Controlador de tasas adaptativas (nullptr = tasas fijas)
+     *
+     * Al cerrar cada generación completa se le entrega el crédito de los operadores
+     * (getOperatorCredit()) y sus tasas pasan al motor con setMutationRates() y
+     * setCrossoverRate(), de modo que la siguiente generación ya las usa. Se llama en
+     * el hilo que ejecuta runGeneration(); el controlador debe vivir más que las
+     * corridas que lo usan. No aplica a runSteadyState(). Al asignarlo, el motor
+     * adopta las tasas actuales del controlador.
+     */
+    void setOperatorRateController(OperatorRateController* controller);
+
+    /**
+     * @brief Crédito de los operadores en la última generación completa
+     * Aplicaciones de cada operador y, sobre la nueva población, 1 / nivel de
+     * dominancia de cada cromosoma que ese operador tocó en la generación.
+     */
+    const OperatorCredit& getOperatorCredit() const;
+
+    /**
+     * @brief Sustituye el flujo aleatorio del motor (p. ej. uno obtenido con Rng::split()
+     * para que cada isla/hilo tenga un flujo independiente derivado de la misma semilla)
+     */
+    void setRandomStream(const Rng& stream);
+
+    /** @brief Semilla con la que se inicializó el motor (para reproducir la ejecución) */
+    std::uint64_t getSeed() const;
+
+    /**
+     * @brief Ejecuta cada fase de la generación como tareas por chunks en el planificador
+     *
+     * Selección, cruza, evaluación, mutación, ordenamiento e hipervolumen se expresan
+     * como un grafo de tareas con dependencias. Cada chunk usa su propio flujo
+     * aleatorio, derivado del flujo del motor según el número de chunk (no del hilo).
+     *
+     * @param scheduler Planificador compartido (nullptr = ejecución serial)
+     * @param chunkSize Individuos por tarea
+     */
+    void setTaskScheduler(TaskScheduler* scheduler, int chunkSize = 16);
+
+    /**
+     * @brief Generación en tubería: la variación se solapa con la evaluación
+     *
+     * Selección, cruza y mutación producen los hijos por chunks en una cadena de
+     * tareas del planificador (setTaskScheduler(); sin él, todo en un hilo) y cada
+     * chunk se evalúa en otra tarea mientras se produce el siguiente. El
+     * ordenamiento empieza en cuanto se evalúa el último chunk. RunControl se
+     * consulta en cada chunk del productor, como en la generación paralela.
+     *
+     * Cambia el algoritmo respecto a los otros modos: solo se mutan los hijos
+     * (antes de evaluarlos), como en NSGA-II clásico, en lugar de mutar la
+     * población combinada; los supervivientes conservan su aptitud y no se
+     * reevalúan. No aplica en modo determinista.
+     */
+    void setPipelineEnabled(bool enabled);
+
+    /**
+     * @brief Modo determinista: resultados idénticos bit a bit con cualquier número de hilos
+     *
+     * Cada generación extrae una clave del flujo del motor y cada elemento de trabajo
+     * (padre, pareja, individuo a mutar, superviviente) usa Rng::keyed(clave, fase,
+     * índice), así que el azar ya no depende del hilo ni del tamaño de chunk. Las
+     * reducciones (ordenamiento, hipervolumen, mejores individuos) se hacen en orden
+     * fijo. Tiene prioridad sobre el modo en tubería; sin planificador se ejecuta el
+     * mismo grafo en un solo hilo. No aplica a runSteadyState().
+     */
+    void setDeterministic(bool enabled);
+
+    /**
+     * @brief Modo asíncrono estacionario (steady-state), sin barreras de generación
+     *
+     * Cada hilo repite sin esperar a los demás: torneo sobre una instantánea
+     * inmutable de la población, cruza, mutación y evaluación de una pareja de
+     * hijos, que entrega a la estructura de supervivencia. La supervivencia
+     * (ordenamiento + truncamiento por nivel y crowding) se aplica por lotes
+     * pequeños y publica una nueva instantánea; los lectores nunca se bloquean.
+     *
+     * El hipervolumen se registra en getHypervolumes() cada 'hvInterval'
+     * evaluaciones integradas a la población en lugar de cada generación: a lo
+     * sumo una fila por lote de supervivencia (aunque el lote cruce varias marcas)
+     * y una final con los últimos hijos.
+     *
+     * @param numEvaluations Presupuesto de hijos evaluados en esta llamada
+     * @param numWorkers Hilos (0 = núcleos disponibles)
+     * @param hvInterval Evaluaciones entre registros de hipervolumen
+     */
+    void runSteadyState(long long numEvaluations, int numWorkers = 0, int hvInterval = 100);
+
+    /** @brief Individuos evaluados desde la creación del motor (todos los modos) */
+    long long getEvaluationCount() const;
+
+    /**
+     * @brief Control de parada/pausa consultado en cada chunk (nullptr = ninguno)
+     * Lo comparten la interfaz y el motor; debe vivir más que las corridas que lo usan.
+     */
+    void setRunControl(RunControl* control);
+
+    /**
+     * @brief Rendimiento reciente del motor
+     *
+     * Evaluaciones y generaciones por segundo en una ventana de las últimas
+     * generaciones, milisegundos por fase y, durante evolve(), tiempo estimado
+     * hasta agotar el presupuesto. Se puede llamar desde otro hilo mientras corre
+     * una generación (p. ej. un monitor sin interfaz). Los campos de caché quedan
+     * en cero: el motor no tiene caché propia.
+     */
+    SolverStats getSolverStats() const;
+
+    // Migración (modelo de islas)
+    /**
+     * @brief Copia de los 'count' mejores individuos no dominados
+     * (ordenados por su mejor nivel de dominancia y luego por crowding)
+     */
+    QVector<Individual> getEmigrants(int count) const;
+
+    /**
+     * @brief Sustituye a los peores individuos por los inmigrantes (ya evaluados)
+     * y reordena la población por dominancia
+     */
+    void acceptImmigrants(const QVector<Individual>& immigrants);
+
     // Getters principales
     const QVector<Individual>& getPopulation() const;               // Población actual
     const QVector<QVector<double>>& getHypervolumes() const;        // Histórico de hipervolúmenes
+    const QVector<HypervolumeStats>& getHypervolumeStats() const;   // Mín/máx/media/varianza por política
     Individual getKneePoint() const;                                // Punto de rodilla (trade-off equilibrado)
     Individual getBestMakespan() const;                             // Mejor solución en Makespan
     Individual getBestEnergy() const;                               // Mejor solución en consumo energético
@@ -69,42 +294,136 @@ public:
      */
     QVector<OperationSchedule> evaluateChromosome(Chromosome& chromosome);
 
+    /**
+     * @brief Decodifica unos genes sin tocar el estado del motor
+     *
+     * Solo lee el escenario (inmutable), así que es seguro llamarla desde varios hilos
+     * a la vez, incluso mientras otro hilo ejecuta generaciones.
+     *
+     * @param policyId Índice de la política (posición del cromosoma en el individuo)
+     * @param genes Máquina asignada a cada operación (1..numMachines)
+     */
+    DecodedSchedule decodeSchedule(int policyId, const QVector<int>& genes) const;
+
 private:
     // === Estado ===
-    ScenarioData scenario;                          // Datos del problema (fijo)
+    std::shared_ptr<const ScenarioData> scenarioData; // Escenario compartido (inmutable)
+    const ScenarioData& scenario;                   // Acceso directo a *scenarioData
     QVector<QString> policyNames;                   // Nombres de las políticas en uso
     QVector<Individual> population;                 // Población actual
     QVector<QVector<double>> hypervolumes;          // Registro histórico de hipervolúmenes por generación
+    QVector<HypervolumeStats> hypervolumeStats;     // Resumen acumulado por política
     double f1_max, f2_max;                          // Peores valores observados (para normalización)
     int populationSize;
+    std::atomic<long long> evaluationCount{0};      // Individuos evaluados (se actualiza desde varios hilos)
 
-    // RNG (generador aleatorio de alta calidad)
-    std::mt19937 rng;
+    // RNG (xoshiro256++ sembrado explícitamente; ver Rng.h)
+    std::uint64_t seed;
+    Rng rng;
     std::uniform_real_distribution<double> dist;    // Distribución [0,1) usada en decisiones probabilísticas
 
+    // Ejecución paralela (opcional)
+    TaskScheduler* scheduler = nullptr;
+    int chunkSize = 16;
+    bool pipelined = false;
+    bool deterministic = false;
+    RunControl* control = nullptr;
+
+    // Asignación de crédito por operador (ver Chromosome::operators)
+    OperatorRateController* rateController = nullptr;
+    int operatorEpoch = 0;                          // Se incrementa al empezar cada generación
+    mutable std::array<std::atomic<long long>, OperatorArmCount> operatorApplications{};
+    OperatorCredit lastCredit;
+
+    /** @brief Crédito de la generación recién terminada; alimenta al controlador si lo hay */
+    void assignOperatorCredit();
+
+    // Instrumentación
+    std::array<std::atomic<long long>, PhaseCount> phaseNs{};  // Trabajo acumulado por fase (todos los hilos)
+    int generationCount = 0;                        // Generaciones completas desde la creación
+    mutable std::mutex statsMutex;                  // Protege lo que sigue
+    ThroughputMeter throughput;
+    double lastEtaSeconds = -1.0;                   // Calculados por evolve()
+    double lastBudgetFraction = 0.0;
+
+    /** @brief Agrega una muestra a la ventana de rendimiento (al cerrar cada generación) */
+    void recordThroughput(bool generationCompleted);
+
     // Parámetros GA (pueden cambiar durante la ejecución si hay adaptación)
     float crossoverRate;
     QVector<float> mutationRates;                   // Una tasa por cada tipo de mutación
 
+    /** @brief Agrega una fila al historial y actualiza las estadísticas por política */
+    void recordHypervolumes(const QVector<double>& values);
+
     // === Evaluación ===
     void evaluateIndividual(Individual& individual);           // Evalúa todos los cromosomas de un individuo
     void evaluatePopulation(QVector<Individual>& pop);         // Evalúa toda una población
 
+    // === Generación en paralelo ===
+    bool runGenerationSerial();                                // runGeneration() en este hilo
+    bool runGenerationParallel();                              // runGeneration() sobre el planificador
+    bool runGenerationPipelined();                             // Variación y evaluación solapadas
+
+    /**
+     * @brief Supervivencia determinista: por cada cromosoma se quedan los 'count'
+     * mejores de 'pop' (ya ordenada) según nivel de dominancia y crowding.
+     * Copia cromosomas completos, así que la aptitud sigue siendo válida.
+     */
+    QVector<Individual> truncateByRank(const QVector<Individual>& pop, int count) const;
+
     // === NSGA-II ===
     void fastNonDominatedSort(QVector<Individual>& pop);       // Ordenamiento rápido por dominancia
+    void sortChromosome(QVector<Individual>& pop, int chromosomeIndex);
+                                                                    // Ordenamiento de una sola política
     void calculateCrowdingDistance(QVector<Individual*>& front, int chromosomeIndex);
                                                                     // Diversidad dentro de cada frente
 
     // === Selección ===
-    Individual tournamentSelection(const QVector<Individual>& pop);   // Selección por torneo binario
-    QVector<Individual> selectParents(const QVector<Individual>& pop); // Selecciona padres para cruce
+    /**
+     * @brief Torneo binario por cromosoma (super-individuo poliploide)
+     * @param winners Salida: winners[c] = índice en pop del ganador para el cromosoma c
+     */
+    void tournamentSelection(const QVector<Individual>& pop, int* winners, Rng& rng);
+
+    /**
+     * @brief Selecciona 'count' super-individuos sin copiar genes
+     * @return Índices planos: result[i * numCromosomas + c] = ganador del cromosoma c del padre i
+     */
+    QVector<int> selectParentIndices(const QVector<Individual>& pop, int count);
+
+    /**
+     * @brief Materializa en 'dest' los super-individuos indicados por 'indices'
+     * (solo se copian los genes; la aptitud queda sin evaluar)
+     */
+    void gatherSelected(const QVector<Individual>& source,
+                        const QVector<int>& indices,
+                        QVector<Individual>& dest) const;
 
     // === Cruza ===
-    QVector<Individual> uniformCrossoverPopulation(const QVector<Individual>& parents);
-                                                                    // Cruza uniforme entre cromosomas
+    /**
+     * @brief Cruza uniforme leyendo los genes directamente de 'source' a través de
+     * los índices de padres; los hijos se escriben en 'offspring' en una sola pasada
+     */
+    void uniformCrossoverPopulation(const QVector<Individual>& source,
+                                    const QVector<int>& parentIndices,
+                                    QVector<Individual>& offspring);
+
+    /**
+     * @brief Cruza de las parejas [pairBegin, pairEnd) sobre hijos ya reservados
+     * (offspring[2p] y offspring[2p + 1] para la pareja p)
+     */
+    void crossoverPairs(const QVector<Individual>& source,
+                        const QVector<int>& parentIndices,
+                        Individual* offspring,
+                        int pairBegin,
+                        int pairEnd,
+                        Rng& rng) const;
 
     // === Mutación ===
     void applyMutations(QVector<Individual>& population);      // Aplica mutaciones según tasas actuales
+    void mutateRange(Individual* individuals, int count, Rng& rng) const;
+                                                                    // Mutaciones sobre un bloque contiguo
 
     // === Utilidades de scheduling ===
     double calculateStartTime(double machineAvailableTime,
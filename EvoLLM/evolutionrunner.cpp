@@ -0,0 +1,317 @@
+#include "evolutionrunner.h"
+#include "promptdigest.h"
+
+#include <QDebug>
+#include <QMetaObject>
+#include <algorithm>
+
+// ================= Constructor =================
+
+EvolutionRunner::EvolutionRunner(QObject* parent)
+    : QObject(parent) {
+    qRegisterMetaType<RunSettings>();
+    qRegisterMetaType<GenerationSnapshot>();
+    qRegisterMetaType<CheckpointData>();
+    qRegisterMetaType<AdviceEvent>();
+    qRegisterMetaType<RunResult>();
+    qRegisterMetaType<QVector<Individual>>();
+    qRegisterMetaType<QVector<HypervolumeStats>>();
+}
+
+EvolutionRunner::~EvolutionRunner() {
+    // La corrutina referencia al motor: se destruye antes que él
+    evolution.reset();
+}
+
+// ================= Control =================
+
+void EvolutionRunner::requestStop() {
+    // El paso en curso (o el siguiente) termina la corrida y emite finished()
+    control.requestStop();
+}
+
+void EvolutionRunner::pause() {
+    control.pause();
+}
+
+void EvolutionRunner::resume() {
+    control.resume();
+}
+
+bool EvolutionRunner::isPaused() const {
+    return control.isPaused();
+}
+
+void EvolutionRunner::start(const RunSettings& settings) {
+    evolution.reset();
+    this->settings = settings;
+    control.reset();
+    completedGenerations = 0;
+    lastProgress = EvolutionProgress();
+
+    mutationRates = settings.mutationRates;
+    crossoverRate = settings.crossoverRate;
+    parameters.clear();
+    adviceEvents.clear();
+    hasPendingAdvice = false;
+
+    // Creado aquí para que viva en el hilo de trabajo (sus respuestas llegan por este bucle)
+    advisor = createAdvisor(settings.advisor);
+    connect(advisor.get(), &HyperparameterAdvisor::adviceReady, this, &EvolutionRunner::onAdviceReady);
+    connect(advisor.get(), &HyperparameterAdvisor::adviceFailed, this,
+            [](int generation, const QString& error, qint64 latencyMs) {
+                qDebug() << "Consejo de la generación" << generation << "fallido:" << error
+                         << "latencia (ms):" << latencyMs;
+            });
+    qDebug() << "Consejero de hiperparámetros:" << advisor->name();
+
+    scenarioPromptText.clear();
+    if (settings.checkpointInterval > 0) {
+        scenarioPromptText = settings.advisor.fullScenarioPrompt ? settings.scenarioText
+                                                                 : scenarioDigest(*settings.scenario);
+    }
+
+    ea = std::make_shared<EvolutionaryAlgorithm>(settings.scenario, settings.policyNames,
+                                                 settings.populationSize, crossoverRate,
+                                                 mutationRates, settings.seed);
+
+    // Las fases de cada generación se reparten entre todos los núcleos
+    if (!scheduler) {
+        scheduler = std::make_unique<TaskScheduler>();
+    }
+    scheduler->resetStats();
+    ea->setTaskScheduler(scheduler.get());
+    ea->setPipelineEnabled(settings.pipelined);
+    ea->setRunControl(&control);
+
+    rateController.reset();
+    if (settings.rateControl.enabled) {
+        rateController = std::make_unique<OperatorRateController>(settings.rateControl);
+        rateController->reset(mutationRates, crossoverRate);
+        ea->setOperatorRateController(rateController.get());
+    }
+
+    runTimer.start();
+    ea->initialize();
+    emit started(ea->getSeed(), ea->getPopulation(), ea->getHypervolumeStats());
+
+    evolution = ea->evolve(settings.budget);
+    scheduleStep();
+}
+
+void EvolutionRunner::cancel() {
+    if (!evolution.isValid()) {
+        return;
+    }
+    evolution.reset();
+    advisor->cancel();
+    emit cancelled();
+}
+
+// ================= Consejos =================
+
+void EvolutionRunner::requestAdvice(const CheckpointData& checkpoint) {
+    // Una consulta a la vez: si la anterior no ha vuelto, este punto se omite
+    if (advisor->isBusy()) {
+        qDebug() << "Consulta al consejero aún en curso; se omite la de la generación"
+                 << checkpoint.generation;
+        return;
+    }
+
+    AdviceContext context;
+    context.generation = checkpoint.generation;
+    context.policyNames = settings.policyNames;
+    context.scenarioText = scenarioPromptText;
+    context.hypervolumes = checkpoint.hypervolumes;
+    context.hypervolumeStats = checkpoint.hypervolumeStats;
+    context.kneePoint = checkpoint.kneePoint;
+    context.bestMakespan = checkpoint.bestMakespan;
+    context.bestEnergy = checkpoint.bestEnergy;
+    context.frontSizes = checkpoint.frontSizes;
+    context.mutationRates = checkpoint.mutationRates;
+    context.crossoverRate = checkpoint.crossoverRate;
+    advisor->request(context);
+}
+
+void EvolutionRunner::onAdviceReady(const AdviceResult& advice) {
+    if (!evolution.isValid() || advice.mutationRates.size() != MutationCount) {
+        return;
+    }
+
+    // Un consejo muy atrasado describe una población que ya no existe
+    const int delay = completedGenerations - advice.generation;
+    if (settings.advisor.maxStaleGenerations > 0 && delay > settings.advisor.maxStaleGenerations) {
+        qDebug() << "Consejo de la generación" << advice.generation << "descartado:"
+                 << delay << "generaciones de retraso";
+        return;
+    }
+
+    // Solo se guarda: step() lo aplica antes de la siguiente generación
+    pendingAdvice = AdviceEvent();
+    pendingAdvice.requestedGeneration = advice.generation;
+    pendingAdvice.mutationRates = advice.mutationRates;
+    pendingAdvice.crossoverRate = advice.crossoverRate;
+    pendingAdvice.latencyMs = advice.latencyMs;
+    hasPendingAdvice = true;
+}
+
+void EvolutionRunner::applyPendingAdvice() {
+    hasPendingAdvice = false;
+
+    AdviceEvent event = pendingAdvice;
+    event.appliedGeneration = completedGenerations + 1;
+    event.previousMutationRates = mutationRates;
+    event.previousCrossoverRate = crossoverRate;
+
+    mutationRates = event.mutationRates;
+    crossoverRate = event.crossoverRate;
+    if (rateController) {
+        rateController->rebase(mutationRates, crossoverRate);
+        crossoverRate = rateController->crossoverRate();    // Con el piso de la cruza
+    }
+    ea->setMutationRates(mutationRates);
+    ea->setCrossoverRate(crossoverRate);
+
+    adviceEvents.append(event);
+    emit adviceApplied(event);
+}
+
+// ================= Ejecución =================
+
+void EvolutionRunner::scheduleStep() {
+    // Encolado: entre generaciones se atienden cancel() y los demás slots
+    QMetaObject::invokeMethod(this, &EvolutionRunner::step, Qt::QueuedConnection);
+}
+
+void EvolutionRunner::step() {
+    if (!evolution.isValid()) {
+        return;
+    }
+
+    // El controlador adaptativo pudo cambiar las tasas al cerrar la generación anterior
+    mutationRates = ea->getMutationRates();
+    crossoverRate = ea->getCrossoverRate();
+
+    // Límite entre generaciones: aquí entra el consejo que haya llegado
+    if (hasPendingAdvice) {
+        applyPendingAdvice();
+    }
+
+    // Los parámetros vigentes son los que usará la generación que se va a ejecutar
+    parameters.append({mutationRates[InterChromosome], mutationRates[ReciprocalExchange],
+                       mutationRates[Shift], crossoverRate});
+
+    const qint64 before = runTimer.nsecsElapsed();
+    if (!evolution.next()) {
+        finishRun();
+        return;
+    }
+    const qint64 after = runTimer.nsecsElapsed();
+
+    const EvolutionProgress& progress = evolution.value();
+
+    // Una generación abandonada no usó los parámetros que se le registraron
+    parameters.resize(progress.generation);
+    completedGenerations = progress.generation;
+    lastProgress.evaluations = progress.evaluations;
+    lastProgress.elapsedSeconds = progress.elapsedSeconds;
+    lastProgress.stopReason = progress.stopReason;
+    lastProgress.stats = progress.stats;
+
+    GenerationSnapshot snapshot;
+    snapshot.generation = progress.generation;
+    snapshot.totalGenerations = progress.totalGenerations;
+    snapshot.budgetFraction = progress.budgetFraction;
+    snapshot.evaluations = progress.evaluations;
+    snapshot.stats = progress.stats;
+    snapshot.hypervolumes = progress.hypervolumes;
+    snapshot.generationMs = (after - before) / 1e6;
+    snapshot.elapsedMs = after / 1e6;
+
+    const int numChromosomes = settings.policyNames.size();
+    snapshot.objectives.resize(numChromosomes);
+    snapshot.front.resize(numChromosomes);
+    for (int c = 0; c < numChromosomes; ++c) {
+        QVector<QPointF>& points = snapshot.objectives[c];
+        points.reserve(progress.snapshot.size());
+        for (const Individual& ind : progress.snapshot) {
+            const Chromosome& chrom = ind.chromosomes[c];
+            points.append(QPointF(chrom.f1, chrom.f2));
+            if (chrom.domLevel == 1) {
+                snapshot.front[c].append(points.last());
+            }
+        }
+    }
+    emit generationFinished(snapshot);
+
+    if (progress.finished) {
+        finishRun();
+        return;
+    }
+
+    const int gen = progress.generation;
+    if (settings.checkpointInterval > 0 && gen % settings.checkpointInterval == 0) {
+        CheckpointData checkpoint;
+        checkpoint.generation = gen;
+        // Solo la cola del historial: el costo no crece con la duración de la corrida
+        const QVector<QVector<double>>& history = ea->getHypervolumes();
+        checkpoint.hypervolumes = history.mid(std::max<qsizetype>(0, history.size() - kRecentHypervolumes));
+        checkpoint.hypervolumeStats = ea->getHypervolumeStats();
+        checkpoint.kneePoint = ea->getKneePoint();
+        checkpoint.bestMakespan = ea->getBestMakespan();
+        checkpoint.bestEnergy = ea->getBestEnergy();
+        checkpoint.frontSizes = QVector<int>(settings.policyNames.size(), 0);
+        for (const Individual& individual : ea->getPopulation()) {
+            for (int c = 0; c < individual.chromosomes.size() && c < checkpoint.frontSizes.size(); ++c) {
+                if (individual.chromosomes[c].domLevel == 1) {
+                    checkpoint.frontSizes[c]++;
+                }
+            }
+        }
+        checkpoint.mutationRates = mutationRates;
+        checkpoint.crossoverRate = crossoverRate;
+        emit checkpointReached(checkpoint);
+        requestAdvice(checkpoint);          // La consulta corre mientras se sigue evolucionando
+    }
+
+    scheduleStep();
+}
+
+void EvolutionRunner::finishRun() {
+    evolution.reset();
+    ea->setRunControl(nullptr);
+    ea->setOperatorRateController(nullptr);
+    advisor->cancel();                      // Un consejo que llega tarde ya no se aplicaría
+
+    QVector<WorkerStats> workerStats = scheduler->getWorkerStats();
+    for (int w = 0; w < workerStats.size(); ++w) {
+        qDebug() << "Trabajador" << w << "utilización:" << workerStats[w].utilization
+                 << "tareas:" << workerStats[w].tasksExecuted
+                 << "robadas:" << workerStats[w].tasksStolen;
+    }
+
+    RunResult result;
+    result.seed = ea->getSeed();
+    result.generations = completedGenerations;
+    result.evaluations = lastProgress.evaluations;
+    result.elapsedSeconds = lastProgress.elapsedSeconds;
+    result.stopReason = lastProgress.stopReason;
+    result.stats = lastProgress.stats;
+    result.population = ea->getPopulation();
+    result.hypervolumes = ea->getHypervolumes();
+    result.hypervolumeStats = ea->getHypervolumeStats();
+    result.parameters = parameters;
+    result.adviceEvents = adviceEvents;
+    result.kneePoint = ea->getKneePoint();
+    result.bestMakespan = ea->getBestMakespan();
+    result.bestEnergy = ea->getBestEnergy();
+
+    // El motor deja de pertenecer a este hilo; la caché solo usa su parte const
+    ea->setTaskScheduler(nullptr);
+    result.schedules = std::make_shared<ScheduleCache>(std::move(ea));
+    result.schedules->prefetch(result.bestMakespan);
+    result.schedules->prefetch(result.kneePoint);
+    result.schedules->prefetch(result.bestEnergy);
+
+    emit finished(result);
+}
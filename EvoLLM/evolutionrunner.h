@@ -0,0 +1,201 @@
+#ifndef EVOLUTION_RUNNER_H
+#define EVOLUTION_RUNNER_H
+
+#include <QObject>
+#include <QVector>
+#include <QString>
+#include <QPointF>
+#include <QElapsedTimer>
+#include <QMetaType>
+#include <cstdint>
+#include <memory>
+#include "EvolutionaryAlgorithm.h"
+#include "schedulecache.h"
+#include "hyperparameteradvisor.h"
+
+/**
+ * @brief Parámetros de una corrida lanzada desde la interfaz
+ */
+struct RunSettings {
+    std::shared_ptr<const ScenarioData> scenario;
+    QVector<QString> policyNames;
+    int populationSize = 0;
+    RunBudget budget;                       // Generaciones, evaluaciones, tiempo y estancamiento
+    int checkpointInterval = 0;             // Cada cuántas generaciones se pide consejo al LLM (0 = nunca)
+    float crossoverRate = 0.0f;
+    QVector<float> mutationRates;
+    std::uint64_t seed = 0;
+    AdvisorSettings advisor;                // Quién da los consejos y con qué límites
+    OperatorRateSettings rateControl;       // Tasas adaptativas por crédito de operador (sin red)
+    bool pipelined = false;                 // Generación en tubería: solo muta a los hijos (ver setPipelineEnabled)
+    QString scenarioText;                   // Archivo del escenario (solo si el prompt lo lleva completo)
+};
+
+/**
+ * @brief Instantánea ligera que se emite al terminar cada generación
+ * (solo objetivos, sin genes: es lo único que la interfaz necesita para dibujar)
+ */
+struct GenerationSnapshot {
+    int generation = 0;
+    int totalGenerations = 0;               // 0 si la corrida no tiene límite de generaciones
+    double budgetFraction = 0.0;            // Avance hacia el límite más cercano [0, 1]
+    long long evaluations = 0;
+    QVector<double> hypervolumes;           // Hipervolumen de cada política
+    QVector<QVector<QPointF>> objectives;   // (makespan, energía) de cada cromosoma, por política
+    QVector<QVector<QPointF>> front;        // Solo los de nivel 1 (frente de Pareto), por política
+    double generationMs = 0.0;              // Duración de esta generación
+    double elapsedMs = 0.0;                 // Tiempo acumulado de la corrida
+    SolverStats stats;                      // Rendimiento en ventana móvil y ETA
+};
+
+// Generaciones de historial que viajan en cada punto de consulta (lo que usa el prompt)
+const int kRecentHypervolumes = 20;
+
+/**
+ * @brief Estado de la corrida en un punto de consulta al LLM
+ */
+struct CheckpointData {
+    int generation = 0;
+    QVector<QVector<double>> hypervolumes;  // Últimas generaciones (a lo sumo kRecentHypervolumes)
+    QVector<HypervolumeStats> hypervolumeStats;
+    Individual kneePoint = Individual({});
+    Individual bestMakespan = Individual({});
+    Individual bestEnergy = Individual({});
+    QVector<int> frontSizes;                // Soluciones no dominadas por política
+    QVector<float> mutationRates;
+    float crossoverRate = 0.0f;
+};
+
+/**
+ * @brief Consejo de hiperparámetros ya aplicado por el motor
+ */
+struct AdviceEvent {
+    int requestedGeneration = 0;            // Punto de consulta que originó el consejo
+    int appliedGeneration = 0;              // Primera generación que corrió con los valores nuevos
+    QVector<float> previousMutationRates;
+    float previousCrossoverRate = 0.0f;
+    QVector<float> mutationRates;
+    float crossoverRate = 0.0f;
+    qint64 latencyMs = 0;                   // Lo que tardó el consejero en responder
+};
+
+/**
+ * @brief Resultado final de una corrida
+ */
+struct RunResult {
+    std::uint64_t seed = 0;
+    int generations = 0;                    // Generaciones completas (las abandonadas no cuentan)
+    long long evaluations = 0;
+    double elapsedSeconds = 0.0;            // Sin contar pausas
+    StopReason stopReason = StopReason::None;
+    SolverStats stats;                      // Rendimiento al terminar
+    QVector<Individual> population;
+    QVector<QVector<double>> hypervolumes;
+    QVector<HypervolumeStats> hypervolumeStats;
+    QVector<QVector<double>> parameters;    // [InterChromosome, RE, Shift, cruza] por generación
+    QVector<AdviceEvent> adviceEvents;      // Cuándo se aplicó cada consejo (para las gráficas)
+    Individual kneePoint = Individual({});
+    Individual bestMakespan = Individual({});
+    Individual bestEnergy = Individual({});
+
+    // Programaciones de los tres individuos destacados, ya decodificadas en el hilo
+    // de trabajo; las vistas piden otras a la misma caché sin tocar el motor
+    std::shared_ptr<ScheduleCache> schedules;
+};
+
+Q_DECLARE_METATYPE(HypervolumeStats)
+Q_DECLARE_METATYPE(RunSettings)
+Q_DECLARE_METATYPE(GenerationSnapshot)
+Q_DECLARE_METATYPE(CheckpointData)
+Q_DECLARE_METATYPE(AdviceEvent)
+Q_DECLARE_METATYPE(RunResult)
+
+/**
+ * @brief Ejecuta el algoritmo evolutivo en un hilo de trabajo
+ *
+ * Vive en un QThread (moveToThread) y es dueño del EvolutionaryAlgorithm y de su
+ * planificador. Avanza la corrutina evolve() una generación por vuelta del bucle de
+ * eventos de su hilo, así que cancel() y los demás slots se atienden entre
+ * generaciones. Todo lo que sale hacia la interfaz son señales encoladas con
+ * copias ligeras: la interfaz nunca ejecuta runGeneration().
+ *
+ * En cada punto de consulta emite checkpointReached(), pide consejo a su
+ * HyperparameterAdvisor (creado según RunSettings::advisor) y sigue evolucionando
+ * con los parámetros vigentes: la consulta corre en paralelo. El consejo que llega
+ * se aplica en el siguiente límite entre generaciones y se anuncia con
+ * adviceApplied(); si el consejero sigue ocupado, el punto de consulta se omite.
+ *
+ * Con RunSettings::rateControl activo, un OperatorRateController ajusta además las
+ * tasas al cerrar cada generación; un consejo aplicado pasa a ser su nuevo punto
+ * de partida y el controlador sigue adaptando desde ahí.
+ *
+ * requestStop(), pause() y resume() se llaman directamente desde cualquier hilo:
+ * actúan sobre el RunControl que consulta el motor en cada chunk, así que surten
+ * efecto a mitad de una generación. Detener no descarta nada: la corrida termina
+ * con finished() y la población de la última generación completa.
+ */
+class EvolutionRunner : public QObject {
+    Q_OBJECT
+
+public:
+    explicit EvolutionRunner(QObject* parent = nullptr);
+    ~EvolutionRunner();
+
+    /** @brief Termina la corrida en el siguiente chunk y emite finished() (seguro entre hilos) */
+    void requestStop();
+
+    /** @brief Congela los hilos del motor en el siguiente chunk (seguro entre hilos) */
+    void pause();
+    void resume();
+    bool isPaused() const;
+
+public slots:
+    /** @brief Inicializa una corrida nueva (cancela la anterior si la hubiera) */
+    void start(const RunSettings& settings);
+
+    /** @brief Descarta la corrida entre generaciones, sin resultados */
+    void cancel();
+
+signals:
+    /** @brief Población inicial ya evaluada */
+    void started(quint64 seed, const QVector<Individual>& population,
+                 const QVector<HypervolumeStats>& hypervolumeStats);
+    void generationFinished(const GenerationSnapshot& snapshot);
+    void checkpointReached(const CheckpointData& checkpoint);
+    void adviceApplied(const AdviceEvent& event);
+    void finished(const RunResult& result);
+    void cancelled();
+
+private slots:
+    void step();
+
+private:
+    RunSettings settings;
+    std::unique_ptr<TaskScheduler> scheduler;
+    RunControl control;                     // Compartido con el motor y con la interfaz
+    std::shared_ptr<EvolutionaryAlgorithm> ea;
+    Generator<EvolutionProgress> evolution;
+
+    QVector<float> mutationRates;           // Parámetros vigentes (pueden venir del LLM)
+    float crossoverRate = 0.0f;
+    QVector<QVector<double>> parameters;
+    QVector<AdviceEvent> adviceEvents;
+    QElapsedTimer runTimer;
+
+    std::unique_ptr<HyperparameterAdvisor> advisor;
+    std::unique_ptr<OperatorRateController> rateController;  // Solo si settings.rateControl.enabled
+    QString scenarioPromptText;             // Resumen del escenario (se calcula una vez por corrida)
+    bool hasPendingAdvice = false;          // Consejo recibido que espera al siguiente límite
+    AdviceEvent pendingAdvice;
+
+    int completedGenerations = 0;
+    EvolutionProgress lastProgress;         // Solo los campos escalares y stats (sin la población)
+
+    void scheduleStep();
+    void requestAdvice(const CheckpointData& checkpoint);
+    void onAdviceReady(const AdviceResult& advice);
+    void applyPendingAdvice();
+    void finishRun();
+};
+
+#endif // EVOLUTION_RUNNER_H
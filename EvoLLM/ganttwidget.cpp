@@ -0,0 +1,265 @@
+#include "ganttwidget.h"
+
+#include <QPainter>
+#include <QPaintEvent>
+#include <QScrollBar>
+#include <QWheelEvent>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+
+namespace {
+
+// Mismas medidas que el Gantt original basado en QGraphicsScene
+const int kRowStep = 40;            // Separación vertical entre máquinas
+const int kRectHeight = 30;         // Alto de cada operación
+const int kLabelGutter = 45;        // Columna fija con las etiquetas de máquina
+const int kTopMargin = 5;
+const int kRightMargin = 100;
+
+// Por debajo de este ancho una operación va a la barra de utilización
+const double kMinRectPixels = 2.0;
+
+// Con menos de este ancho no se intenta siquiera medir la etiqueta
+const double kMinLabelPixels = 30.0;
+
+const double kMinTimeScale = 1e-6;
+const double kMaxTimeScale = 1000.0;
+
+} // namespace
+
+// ================= Constructor =================
+
+GanttWidget::GanttWidget(QWidget* parent)
+    : QAbstractScrollArea(parent)
+{
+    setHorizontalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+    setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+    viewport()->setBackgroundRole(QPalette::Base);
+    viewport()->setAutoFillBackground(true);
+}
+
+// ================= Datos =================
+
+void GanttWidget::setSchedule(const DecodedSchedule& decoded)
+{
+    const QVector<ScheduledOperation>& schedule = decoded.operations;
+    const int numMachines = decoded.numMachines;
+
+    lanes = QVector<MachineLane>(numMachines);
+    makespan = 0.0;
+
+    // Conteo previo para reservar cada arreglo una sola vez
+    QVector<int> counts(numMachines, 0);
+    for (const ScheduledOperation& op : schedule) {
+        if (op.machineId >= 0 && op.machineId < numMachines) {
+            counts[op.machineId]++;
+        }
+    }
+    for (int m = 0; m < numMachines; ++m) {
+        lanes[m].start.reserve(counts[m]);
+        lanes[m].end.reserve(counts[m]);
+        lanes[m].job.reserve(counts[m]);
+        lanes[m].operation.reserve(counts[m]);
+    }
+
+    // Índices ordenados por inicio: cada carril queda ordenado al repartirlos
+    QVector<int> order(schedule.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&schedule](int a, int b) {
+        return schedule[a].startTime < schedule[b].startTime;
+    });
+
+    for (int i : order) {
+        const ScheduledOperation& op = schedule[i];
+        if (op.machineId < 0 || op.machineId >= numMachines) {
+            continue;
+        }
+        MachineLane& lane = lanes[op.machineId];
+        lane.start.append(op.startTime);
+        lane.end.append(op.endTime);
+        lane.job.append(op.jobId);
+        lane.operation.append(op.operationId);
+        makespan = std::max(makespan, op.endTime);
+    }
+
+    updateScrollBars();
+    viewport()->update();
+}
+
+void GanttWidget::setTimeScale(double pixelsPerUnit)
+{
+    timeScale = std::clamp(pixelsPerUnit, kMinTimeScale, kMaxTimeScale);
+    updateScrollBars();
+    viewport()->update();
+}
+
+double GanttWidget::getTimeScale() const
+{
+    return timeScale;
+}
+
+void GanttWidget::zoomToFit()
+{
+    if (makespan <= 0.0) {
+        return;
+    }
+    const int available = viewport()->width() - kLabelGutter - kRightMargin;
+    setTimeScale(std::max(1, available) / makespan);
+}
+
+int GanttWidget::contentHeight() const
+{
+    return lanes.size() * kRowStep + kTopMargin + 25;
+}
+
+// ================= Desplazamiento y zoom =================
+
+void GanttWidget::updateScrollBars()
+{
+    const int contentWidth = static_cast<int>(std::ceil(makespan * timeScale)) + kRightMargin;
+    const int visibleWidth = viewport()->width() - kLabelGutter;
+
+    horizontalScrollBar()->setRange(0, std::max(0, contentWidth - visibleWidth));
+    horizontalScrollBar()->setPageStep(std::max(1, visibleWidth));
+    horizontalScrollBar()->setSingleStep(20);
+
+    verticalScrollBar()->setRange(0, std::max(0, contentHeight() - viewport()->height()));
+    verticalScrollBar()->setPageStep(std::max(1, viewport()->height()));
+    verticalScrollBar()->setSingleStep(kRowStep);
+}
+
+void GanttWidget::resizeEvent(QResizeEvent* event)
+{
+    QAbstractScrollArea::resizeEvent(event);
+    updateScrollBars();
+}
+
+void GanttWidget::scrollContentsBy(int, int)
+{
+    viewport()->update();
+}
+
+void GanttWidget::wheelEvent(QWheelEvent* event)
+{
+    if (!(event->modifiers() & Qt::ControlModifier)) {
+        QAbstractScrollArea::wheelEvent(event);
+        return;
+    }
+
+    // El instante bajo el cursor queda en el mismo píxel después del zoom
+    const double cursorX = event->position().x() - kLabelGutter;
+    const double timeAtCursor = (horizontalScrollBar()->value() + cursorX) / timeScale;
+
+    const double factor = event->angleDelta().y() > 0 ? 1.25 : 0.8;
+    setTimeScale(timeScale * factor);
+
+    horizontalScrollBar()->setValue(static_cast<int>(timeAtCursor * timeScale - cursorX));
+    event->accept();
+}
+
+// ================= Dibujo =================
+
+QColor GanttWidget::jobColor(int jobId)
+{
+    // Determinista: el mismo job tiene el mismo color en todos los diagramas
+    return QColor::fromHsv((jobId * 137) % 360, 110 + (jobId * 53) % 90, 230);
+}
+
+void GanttWidget::paintEvent(QPaintEvent* event)
+{
+    QPainter painter(viewport());
+    painter.setClipRect(event->rect());
+
+    const int scrollX = horizontalScrollBar()->value();
+    const int scrollY = verticalScrollBar()->value();
+    const int chartWidth = viewport()->width() - kLabelGutter;
+    if (chartWidth <= 0 || lanes.isEmpty()) {
+        return;
+    }
+
+    // Ventana de tiempo visible
+    const double t0 = scrollX / timeScale;
+    const double t1 = (scrollX + chartWidth) / timeScale;
+
+    // Filas visibles según el área a repintar
+    const int firstRow = std::max(0, (event->rect().top() + scrollY - kTopMargin) / kRowStep);
+    const int lastRow = std::min<int>(lanes.size() - 1,
+                                      (event->rect().bottom() + scrollY - kTopMargin) / kRowStep);
+
+    const QFont labelFont("Arial", 8);
+    painter.setFont(labelFont);
+    const QFontMetrics metrics(labelFont);
+
+    QVector<double> busy(chartWidth);       // Ocupación acumulada por píxel (barras de utilización)
+
+    painter.save();
+    painter.setClipRect(QRect(kLabelGutter, 0, chartWidth, viewport()->height()), Qt::IntersectClip);
+
+    for (int m = firstRow; m <= lastRow; ++m) {
+        const MachineLane& lane = lanes[m];
+        const int y = kTopMargin + m * kRowStep - scrollY;
+
+        // Primera operación que termina después de t0 y última que empieza antes de t1
+        const int begin = std::upper_bound(lane.end.begin(), lane.end.end(), t0) - lane.end.begin();
+        const int end = std::lower_bound(lane.start.begin(), lane.start.end(), t1) - lane.start.begin();
+
+        std::fill(busy.begin(), busy.end(), 0.0);
+        bool anyBusy = false;
+
+        for (int i = begin; i < end; ++i) {
+            const double x0 = lane.start[i] * timeScale - scrollX;
+            const double x1 = lane.end[i] * timeScale - scrollX;
+            const double width = x1 - x0;
+
+            if (width < kMinRectPixels) {
+                // Se reparte la fracción ocupada entre los píxeles que toca
+                const int p0 = std::max(0, static_cast<int>(std::floor(x0)));
+                const int p1 = std::min(chartWidth - 1, static_cast<int>(std::floor(x1)));
+                for (int p = p0; p <= p1; ++p) {
+                    const double covered = std::min(x1, p + 1.0) - std::max(x0, double(p));
+                    busy[p] += std::max(0.0, covered);
+                }
+                anyBusy = true;
+                continue;
+            }
+
+            const QRectF rect(kLabelGutter + x0, y, width, kRectHeight);
+            painter.setPen(width >= 4.0 ? QPen(Qt::black) : Qt::NoPen);
+            painter.setBrush(jobColor(lane.job[i]));
+            painter.drawRect(rect);
+
+            // La etiqueta solo se construye si puede caber
+            if (width >= kMinLabelPixels) {
+                const QString label = QString("J%1-O%2").arg(lane.job[i]).arg(lane.operation[i]);
+                if (metrics.horizontalAdvance(label) + 6 <= width) {
+                    painter.setPen(Qt::black);
+                    painter.drawText(rect.adjusted(3, 0, 0, 0), Qt::AlignLeft | Qt::AlignVCenter, label);
+                }
+            }
+        }
+
+        if (anyBusy) {
+            painter.setPen(QColor(90, 90, 90));
+            for (int p = 0; p < chartWidth; ++p) {
+                if (busy[p] <= 0.0) {
+                    continue;
+                }
+                const int height = std::max(1, static_cast<int>(std::round(std::min(1.0, busy[p]) * kRectHeight)));
+                const int x = kLabelGutter + p;
+                painter.drawLine(x, y + kRectHeight - height, x, y + kRectHeight - 1);
+            }
+        }
+    }
+
+    painter.restore();
+
+    // Etiquetas de máquina en la columna fija de la izquierda
+    painter.setFont(QFont("Arial", 9, QFont::Bold));
+    painter.setPen(Qt::black);
+    for (int m = firstRow; m <= lastRow; ++m) {
+        const int y = kTopMargin + m * kRowStep - scrollY;
+        painter.drawText(QRect(0, y, kLabelGutter - 5, kRectHeight),
+                         Qt::AlignRight | Qt::AlignVCenter, QString("M%1").arg(m));
+    }
+}
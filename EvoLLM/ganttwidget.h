@@ -0,0 +1,72 @@
+#ifndef GANTTWIDGET_H
+#define GANTTWIDGET_H
+
+#include <QAbstractScrollArea>
+#include <QVector>
+#include <QColor>
+#include "scheduletypes.h"
+
+/**
+ * @brief Diagrama de Gantt con nivel de detalle para programaciones grandes
+ *
+ * No crea un objeto gráfico por operación: la programación se guarda en arreglos
+ * compactos por máquina (inicio, fin, job, operación) ordenados por tiempo, y el
+ * paintEvent solo recorre las operaciones que caen en la ventana visible
+ * (búsqueda binaria sobre los tiempos de fin).
+ *
+ * Nivel de detalle según el ancho en pantalla de cada operación:
+ * - Suficientemente ancha: rectángulo con el color del job (y etiqueta si cabe)
+ * - Más angosta que un par de píxeles: se acumula en una barra de utilización por
+ *   píxel, cuya altura es la fracción de ese píxel en que la máquina estuvo ocupada
+ *
+ * Ctrl + rueda acerca/aleja alrededor del cursor.
+ */
+class GanttWidget : public QAbstractScrollArea
+{
+    Q_OBJECT
+
+public:
+    explicit GanttWidget(QWidget* parent = nullptr);
+
+    /**
+     * @brief Reemplaza la programación mostrada
+     * @param schedule Programación ya decodificada (operaciones en cualquier orden)
+     */
+    void setSchedule(const DecodedSchedule& schedule);
+
+    /** @brief Píxeles por unidad de tiempo */
+    void setTimeScale(double pixelsPerUnit);
+    double getTimeScale() const;
+
+    /** @brief Ajusta la escala para que toda la programación quepa a lo ancho */
+    void zoomToFit();
+
+    /** @brief Alto total de las filas (para que el contenedor reserve espacio) */
+    int contentHeight() const;
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
+    void wheelEvent(QWheelEvent* event) override;
+    void scrollContentsBy(int dx, int dy) override;
+
+private:
+    // Operaciones de una máquina en arreglos paralelos, ordenadas por inicio.
+    // En una máquina las operaciones no se solapan, así que los fines también
+    // quedan ordenados y sirven para la búsqueda binaria.
+    struct MachineLane {
+        QVector<double> start;
+        QVector<double> end;
+        QVector<int> job;
+        QVector<int> operation;
+    };
+
+    QVector<MachineLane> lanes;
+    double makespan = 0.0;
+    double timeScale = 10.0;
+
+    void updateScrollBars();
+    static QColor jobColor(int jobId);
+};
+
+#endif // GANTTWIDGET_H
@@ -0,0 +1,96 @@
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+/**
+ * @file Generator.h
+ * @brief Generador perezoso basado en corrutinas de C++20
+ *
+ * La corrutina no avanza hasta que el consumidor llama a next(); cada co_yield
+ * la suspende y deja el valor disponible en value(). Destruir el generador
+ * cancela la corrutina en el punto donde esté suspendida.
+ *
+ * Uso:
+ *   Generator<int> g = producir();
+ *   while (g.next()) usar(g.value());
+ */
+template <typename T>
+class Generator {
+public:
+    struct promise_type {
+        std::optional<T> current;
+        std::exception_ptr error;
+
+        Generator get_return_object() {
+            return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        std::suspend_always yield_value(T value) {
+            current = std::move(value);
+            return {};
+        }
+        void return_void() {}
+        void unhandled_exception() { error = std::current_exception(); }
+    };
+
+    Generator() = default;
+
+    Generator(Generator&& other) noexcept
+        : handle(std::exchange(other.handle, nullptr)) {}
+
+    Generator& operator=(Generator&& other) noexcept {
+        if (this != &other) {
+            reset();
+            handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+
+    Generator(const Generator&) = delete;
+    Generator& operator=(const Generator&) = delete;
+
+    ~Generator() { reset(); }
+
+    /**
+     * @brief Reanuda la corrutina hasta el siguiente co_yield
+     * @return false si la corrutina terminó (no hay valor nuevo)
+     * @throws La excepción que haya escapado de la corrutina
+     */
+    bool next() {
+        if (!handle || handle.done()) {
+            return false;
+        }
+        handle.resume();
+        if (handle.promise().error) {
+            std::rethrow_exception(std::exchange(handle.promise().error, nullptr));
+        }
+        return !handle.done();
+    }
+
+    /** @brief Último valor entregado (válido después de un next() que devolvió true) */
+    const T& value() const { return *handle.promise().current; }
+
+    /** @brief true si hay una corrutina asociada (aunque ya haya terminado) */
+    bool isValid() const { return static_cast<bool>(handle); }
+
+    /** @brief Destruye la corrutina (cancela la ejecución pendiente) */
+    void reset() {
+        if (handle) {
+            handle.destroy();
+            handle = nullptr;
+        }
+    }
+
+private:
+    explicit Generator(std::coroutine_handle<promise_type> handle)
+        : handle(handle) {}
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+#endif // GENERATOR_H
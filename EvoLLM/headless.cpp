@@ -0,0 +1,446 @@
+#include "headless.h"
+
+#include <QCommandLineParser>
+#include <QDir>
+#include <QTextStream>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "shmislands.h"
+#include "islandmodel.h"
+#include "batchrunner.h"
+#include "ScenarioLoader.h"
+
+// ================= Detección =================
+
+bool isHeadlessInvocation(int argc, char* argv[]) {
+    static const char* const modes[] = { "--islands", "--threaded-islands", "--steady-state", "--island-worker",
+                                         "--batch", "--check-determinism", "--check-scheduler", "--benchmark" };
+
+    for (int i = 1; i < argc; ++i) {
+        for (const char* mode : modes) {
+            if (std::strcmp(argv[i], mode) == 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// ================= Modos =================
+
+static QVector<QString> parsePolicies(const QString& list) {
+    QVector<QString> policies;
+    for (const QString& name : list.split(',', Qt::SkipEmptyParts)) {
+        policies.append(name.trimmed());
+    }
+    return policies;
+}
+
+static int runIslands(const QCommandLineParser& parser) {
+    QTextStream out(stdout);
+
+    ShmIslandConfig config;
+    config.scenarioPath = parser.value("islands");
+    if (parser.isSet("procs"))       config.numIslands = parser.value("procs").toInt();
+    if (parser.isSet("generations")) config.numGenerations = parser.value("generations").toInt();
+    if (parser.isSet("population"))  config.populationSize = parser.value("population").toInt();
+    if (parser.isSet("interval"))    config.migrationInterval = parser.value("interval").toInt();
+    if (parser.isSet("migrants"))    config.migrantsPerExchange = parser.value("migrants").toInt();
+    if (parser.isSet("seed"))        config.seed = parser.value("seed").toULongLong();
+    if (parser.isSet("policies"))    config.policyNames = parsePolicies(parser.value("policies"));
+
+    IslandCoordinator coordinator(config);
+    if (!coordinator.run()) {
+        return 1;
+    }
+
+    out << "seed " << coordinator.getSeed() << "\n";
+
+    const QPair<double, double> reference = coordinator.getReferencePoint();
+    out << "reference " << reference.first << " " << reference.second << "\n";
+
+    const QVector<QVector<double>>& hv = coordinator.getHypervolumes();
+    const QVector<int>& generations = coordinator.getHypervolumeGenerations();
+    for (int row = 0; row < hv.size(); ++row) {
+        out << "gen " << generations[row];
+        for (double value : hv[row]) {
+            out << " " << value;
+        }
+        out << "\n";
+    }
+
+    out << "front " << coordinator.getGlobalFront().size() << "\n";
+    for (int island : coordinator.getFailedIslands()) {
+        out << "failed_island " << island << "\n";
+    }
+
+    return 0;
+}
+
+// Mismas opciones que --islands, pero con un hilo por isla dentro de este proceso
+static int runThreadedIslands(const QCommandLineParser& parser) {
+    QTextStream out(stdout);
+
+    IslandConfig config;
+    if (parser.isSet("procs"))       config.numIslands = parser.value("procs").toInt();
+    if (parser.isSet("population"))  config.populationSize = parser.value("population").toInt();
+    if (parser.isSet("interval"))    config.migrationInterval = parser.value("interval").toInt();
+    if (parser.isSet("migrants"))    config.migrantsPerExchange = parser.value("migrants").toInt();
+    if (parser.isSet("seed"))        config.seed = parser.value("seed").toULongLong();
+    if (parser.value("topology") == "full") config.topology = FullyConnectedTopology;
+
+    const int generations = parser.isSet("generations") ? parser.value("generations").toInt() : 100;
+    const QVector<QString> policies = parser.isSet("policies") ? parsePolicies(parser.value("policies"))
+                                                               : QVector<QString>{"FIFO", "LTP"};
+
+    if (config.numIslands < 1 || config.migrationInterval < 1 || generations < 0) {
+        out << "Configuracion de islas invalida\n";
+        return 1;
+    }
+
+    std::shared_ptr<const ScenarioData> scenario;
+    try {
+        scenario = std::make_shared<const ScenarioData>(loadScenario(parser.value("threaded-islands"), policies));
+    } catch (const std::exception& e) {
+        out << "No se pudo cargar el escenario: " << e.what() << "\n";
+        return 1;
+    }
+
+    IslandModel model(scenario, policies, config);
+    model.initialize();
+    model.run(generations);
+
+    out << "seed " << model.getSeed() << "\n";
+    out << "front " << model.getGlobalFront().size() << "\n";
+    out << "migrations_sent " << model.getMigrationsSent()
+        << " migrations_dropped " << model.getMigrationsDropped() << "\n";
+    return 0;
+}
+
+// Motor estacionario asíncrono: un presupuesto de evaluaciones en lugar de generaciones
+static int runSteadyState(const QCommandLineParser& parser) {
+    QTextStream out(stdout);
+
+    const std::uint64_t seed = parser.isSet("seed") ? parser.value("seed").toULongLong() : 12345;
+    const int populationSize = parser.isSet("population") ? parser.value("population").toInt() : 50;
+    const int threads = parser.isSet("threads") ? parser.value("threads").toInt() : 0;
+    const long long evaluations = parser.isSet("evaluations") ? parser.value("evaluations").toLongLong() : 10000;
+    const int hvInterval = parser.isSet("hv-interval") ? parser.value("hv-interval").toInt() : 500;
+    const QVector<QString> policies = parser.isSet("policies") ? parsePolicies(parser.value("policies"))
+                                                               : QVector<QString>{"FIFO", "LTP"};
+
+    if (populationSize < 2 || evaluations < 0) {
+        out << "Configuracion invalida\n";
+        return 1;
+    }
+
+    std::shared_ptr<const ScenarioData> scenario;
+    try {
+        scenario = std::make_shared<const ScenarioData>(loadScenario(parser.value("steady-state"), policies));
+    } catch (const std::exception& e) {
+        out << "No se pudo cargar el escenario: " << e.what() << "\n";
+        return 1;
+    }
+
+    EvolutionaryAlgorithm ea(scenario, policies, populationSize, 0.8f,
+                             QVector<float>(MutationCount, 0.1f), seed);
+    ea.initialize();
+
+    const long long before = ea.getEvaluationCount();
+    ea.runSteadyState(evaluations, threads, hvInterval);
+
+    out << "seed " << ea.getSeed() << " evaluations " << ea.getEvaluationCount() - before << "\n";
+    const QVector<QVector<double>>& hv = ea.getHypervolumes();
+    for (int row = 0; row < hv.size(); ++row) {
+        out << "hv " << row;
+        for (double value : hv[row]) {
+            out << " " << value;
+        }
+        out << "\n";
+    }
+    return 0;
+}
+
+static int runBatch(const QCommandLineParser& parser) {
+    BatchConfig config;
+    if (!parser.value("batch").isEmpty()) config.scenarioDir = parser.value("batch");
+    if (parser.isSet("seeds"))       config.numSeeds = parser.value("seeds").toInt();
+    if (parser.isSet("base-seed"))   config.baseSeed = parser.value("base-seed").toULongLong();
+    if (parser.isSet("generations")) config.numGenerations = parser.value("generations").toInt();
+    if (parser.isSet("population"))  config.populationSize = parser.value("population").toInt();
+    if (parser.isSet("jobs"))        config.maxConcurrentRuns = parser.value("jobs").toInt();
+    if (parser.isSet("out"))         config.summaryPath = parser.value("out");
+    config.rateControl.enabled = parser.isSet("adaptive-rates");
+
+    // Conjuntos separados por ';', políticas por ','
+    if (parser.isSet("policy-sets")) {
+        config.policySets.clear();
+        for (const QString& set : parser.value("policy-sets").split(';', Qt::SkipEmptyParts)) {
+            config.policySets.append(parsePolicies(set));
+        }
+    }
+
+    BatchRunner runner(config);
+    if (!runner.run()) {
+        return 1;
+    }
+
+    QTextStream(stdout) << "summary " << config.summaryPath << "\n";
+    return 0;
+}
+
+// Igualdad exacta (bit a bit en los double) de poblaciones e historiales
+static bool identicalRuns(const EvolutionaryAlgorithm& a, const EvolutionaryAlgorithm& b) {
+    if (a.getHypervolumes() != b.getHypervolumes()) {
+        return false;
+    }
+
+    const QVector<Individual>& popA = a.getPopulation();
+    const QVector<Individual>& popB = b.getPopulation();
+    if (popA.size() != popB.size()) {
+        return false;
+    }
+
+    for (int i = 0; i < popA.size(); ++i) {
+        for (int c = 0; c < popA[i].getNumChromosomes(); ++c) {
+            const Chromosome& x = popA[i].chromosomes[c];
+            const Chromosome& y = popB[i].chromosomes[c];
+            if (x.genes != y.genes || x.f1 != y.f1 || x.f2 != y.f2 ||
+                x.domLevel != y.domLevel || x.crowdingDistance != y.crowdingDistance) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static int runDeterminismCheck(const QCommandLineParser& parser) {
+    QTextStream out(stdout);
+
+    const QDir dir(parser.value("check-determinism"));
+    const std::uint64_t seed = parser.isSet("seed") ? parser.value("seed").toULongLong() : 12345;
+    const int generations = parser.isSet("generations") ? parser.value("generations").toInt() : 20;
+    const int populationSize = parser.isSet("population") ? parser.value("population").toInt() : 50;
+    const QVector<QString> policies = parser.isSet("policies") ? parsePolicies(parser.value("policies"))
+                                                               : QVector<QString>{"FIFO", "LTP"};
+    const int threadCounts[] = { 1, 8, 64 };
+
+    const QStringList files = dir.entryList({"*.txt"}, QDir::Files, QDir::Name);
+    if (files.isEmpty()) {
+        out << "No hay escenarios en " << dir.path() << "\n";
+        return 1;
+    }
+
+    bool allIdentical = true;
+    for (const QString& file : files) {
+        std::shared_ptr<const ScenarioData> scenario;
+        try {
+            scenario = std::make_shared<const ScenarioData>(loadScenario(dir.filePath(file), policies));
+        } catch (const std::exception& e) {
+            out << file << ": no se pudo cargar (" << e.what() << ")\n";
+            allIdentical = false;
+            continue;
+        }
+
+        std::unique_ptr<EvolutionaryAlgorithm> reference;
+        bool identical = true;
+
+        for (int threads : threadCounts) {
+            TaskScheduler scheduler(threads);
+            auto ea = std::make_unique<EvolutionaryAlgorithm>(
+                scenario, policies, populationSize, 0.8f,
+                QVector<float>(MutationCount, 0.1f), seed);
+            ea->setDeterministic(true);
+            ea->setTaskScheduler(&scheduler, 4);
+            ea->initialize();
+            for (int gen = 0; gen < generations; ++gen) {
+                ea->runGeneration();
+            }
+
+            if (!reference) {
+                reference = std::move(ea);
+            } else if (!identicalRuns(*reference, *ea)) {
+                out << file << ": difiere con " << threads << " hilos\n";
+                identical = false;
+            }
+        }
+
+        out << file << (identical ? ": OK" : ": FALLA") << "\n";
+        allIdentical = allIdentical && identical;
+    }
+
+    return allIdentical ? 0 : 1;
+}
+
+// Muchos grafos pequeños seguidos: es cuando un trabajador rezagado del grafo
+// anterior se cruza con las tareas del siguiente
+static int runSchedulerCheck(const QCommandLineParser& parser) {
+    QTextStream out(stdout);
+
+    const int graphs = std::max(1, parser.value("check-scheduler").toInt());
+    const int threads = parser.isSet("threads") ? parser.value("threads").toInt() : 0;
+    const int items = 64;
+
+    TaskScheduler scheduler(threads);
+    std::vector<std::atomic<int>> hits(items);
+    int failures = 0;
+
+    for (int g = 0; g < graphs; ++g) {
+        for (std::atomic<int>& hit : hits) {
+            hit.store(0, std::memory_order_relaxed);
+        }
+        std::atomic<int> stage{0};
+        std::atomic<bool> ok{true};
+        const bool throwing = g % 1000 == 999;
+
+        // raíz → parallelFor (grano variable) → unión → verificación
+        TaskGraph graph;
+        int root = graph.addTask([&](int) { stage.store(1); });
+        QVector<int> chunks = graph.addParallelFor(0, items, 1 + g % 8,
+            [&](int begin, int end, int, int) {
+                if (stage.load() != 1) ok = false;
+                for (int i = begin; i < end; ++i) hits[i].fetch_add(1);
+            }, {root});
+        int joined = graph.addJoin(chunks);
+        graph.addTask([&](int) {
+            for (const std::atomic<int>& hit : hits) {
+                if (hit.load() != 1) ok = false;
+            }
+            if (throwing) throw std::runtime_error("esperada");
+        }, {joined});
+
+        bool rethrown = false;
+        try {
+            scheduler.run(graph);
+        } catch (const std::runtime_error&) {
+            rethrown = true;
+        }
+
+        if (!ok || rethrown != throwing) {
+            out << "grafo " << g << ": FALLA\n";
+            ++failures;
+        }
+    }
+
+    out << "graphs " << graphs << " threads " << scheduler.getNumWorkers()
+        << (failures == 0 ? ": OK" : ": FALLA") << "\n";
+    return failures == 0 ? 0 : 1;
+}
+
+static int runBenchmark(const QCommandLineParser& parser) {
+    QTextStream out(stdout);
+
+    const std::uint64_t seed = parser.isSet("seed") ? parser.value("seed").toULongLong() : 12345;
+    const int populationSize = parser.isSet("population") ? parser.value("population").toInt() : 100;
+    const int threads = parser.isSet("threads") ? parser.value("threads").toInt() : 0;
+    const QVector<QString> policies = parser.isSet("policies") ? parsePolicies(parser.value("policies"))
+                                                               : QVector<QString>{"FIFO", "LTP"};
+
+    RunBudget budget;
+    budget.maxSeconds = parser.isSet("seconds") ? parser.value("seconds").toDouble() : 30.0;
+    if (parser.isSet("generations")) budget.maxGenerations = parser.value("generations").toInt();
+
+    std::shared_ptr<const ScenarioData> scenario;
+    try {
+        scenario = std::make_shared<const ScenarioData>(loadScenario(parser.value("benchmark"), policies));
+    } catch (const std::exception& e) {
+        out << "No se pudo cargar el escenario: " << e.what() << "\n";
+        return 1;
+    }
+
+    TaskScheduler scheduler(threads);
+    EvolutionaryAlgorithm ea(scenario, policies, populationSize, 0.8f,
+                             QVector<float>(MutationCount, 0.1f), seed);
+    ea.setTaskScheduler(&scheduler);
+    ea.setPipelineEnabled(parser.isSet("pipelined"));
+    ea.initialize();
+
+    out << "threads " << scheduler.getNumWorkers() << " population " << populationSize
+        << (parser.isSet("pipelined") ? " pipelined" : "") << "\n";
+
+    // Una línea por segundo: evolve() encadena generaciones hasta agotar cada porción
+    Generator<EvolutionProgress> evolution = ea.evolve(budget, 1000);
+    while (evolution.next()) {
+        const EvolutionProgress& progress = evolution.value();
+        out << formatSolverStats(progress.stats) << "\n";
+        out.flush();
+    }
+
+    const SolverStats stats = ea.getSolverStats();
+    out << "total_evaluations " << stats.evaluations
+        << " total_generations " << stats.generations
+        << " seconds " << stats.elapsedSeconds << "\n";
+    return 0;
+}
+
+int runHeadless(const QStringList& arguments) {
+    // El trabajador recibe argumentos posicionales fijos del coordinador
+    const int workerAt = arguments.indexOf("--island-worker");
+    if (workerAt >= 0) {
+        if (workerAt + 2 >= arguments.size()) {
+            QTextStream(stderr) << "Uso: --island-worker <clave> <isla>\n";
+            return 2;
+        }
+        return runIslandWorker(arguments[workerAt + 1], arguments[workerAt + 2].toInt());
+    }
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    parser.addOptions({
+        {"islands", "Coordinador de islas multiproceso sobre el escenario dado.", "escenario"},
+        {"threaded-islands", "Modelo de islas con un hilo por isla sobre el escenario dado.", "escenario"},
+        {"procs", "Numero de islas (procesos o hilos).", "n"},
+        {"topology", "Topologia de migracion con hilos: ring o full.", "ring|full"},
+        {"steady-state", "Motor estacionario asincrono sobre el escenario dado.", "escenario"},
+        {"evaluations", "Presupuesto de evaluaciones del modo estacionario.", "n"},
+        {"hv-interval", "Evaluaciones entre registros de hipervolumen.", "n"},
+        {"generations", "Generaciones por isla.", "g"},
+        {"population", "Tamano de poblacion por isla.", "p"},
+        {"interval", "Generaciones entre migraciones.", "k"},
+        {"migrants", "Migrantes por intercambio.", "m"},
+        {"seed", "Semilla global (0 = aleatoria).", "s"},
+        {"policies", "Politicas separadas por coma.", "lista"},
+        {"batch", "Campana por lotes sobre los escenarios del directorio.", "directorio"},
+        {"seeds", "Semillas por escenario y conjunto de politicas.", "n"},
+        {"base-seed", "Primera semilla de la campana.", "s"},
+        {"policy-sets", "Conjuntos de politicas (';' entre conjuntos, ',' entre politicas).", "lista"},
+        {"jobs", "Corridas simultaneas (0 = nucleos disponibles).", "j"},
+        {"out", "Archivo CSV de resumen.", "archivo"},
+        {"adaptive-rates", "Adapta las tasas de mutacion y cruza por credito de operador."},
+        {"check-determinism", "Verifica el modo determinista con 1, 8 y 64 hilos.", "directorio"},
+        {"check-scheduler", "Ejecuta muchos grafos pequenos seguidos en el planificador.", "n"},
+        {"benchmark", "Mide el rendimiento del motor sobre el escenario dado.", "escenario"},
+        {"seconds", "Limite de tiempo de la corrida de medicion.", "s"},
+        {"threads", "Hilos del planificador (0 = nucleos disponibles).", "n"},
+        {"pipelined", "Generacion en tuberia: solapa variacion y evaluacion; solo muta a los hijos."},
+    });
+    parser.process(arguments);
+
+    if (parser.isSet("islands")) {
+        return runIslands(parser);
+    }
+    if (parser.isSet("threaded-islands")) {
+        return runThreadedIslands(parser);
+    }
+    if (parser.isSet("steady-state")) {
+        return runSteadyState(parser);
+    }
+    if (parser.isSet("batch")) {
+        return runBatch(parser);
+    }
+    if (parser.isSet("check-determinism")) {
+        return runDeterminismCheck(parser);
+    }
+    if (parser.isSet("check-scheduler")) {
+        return runSchedulerCheck(parser);
+    }
+    if (parser.isSet("benchmark")) {
+        return runBenchmark(parser);
+    }
+
+    parser.showHelp(2);
+}
@@ -0,0 +1,59 @@
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+#include <QStringList>
+
+/**
+ * @file Headless.h
+ * @brief Modos de línea de comandos sin interfaz gráfica
+ *
+ *   EvoLLM --islands <escenario> [--procs N] [--generations G] [--population P]
+ *          [--interval K] [--migrants M] [--seed S] [--policies FIFO,LTP]
+ *       Coordinador de islas multiproceso sobre memoria compartida.
+ *
+ *   EvoLLM --threaded-islands <escenario> [--procs N] [--generations G] [--population P]
+ *          [--interval K] [--migrants M] [--seed S] [--policies FIFO,LTP] [--topology ring|full]
+ *       Las mismas islas en un solo proceso, un hilo por isla (IslandModel), con
+ *       migración por colas SPSC; imprime el tamaño del frente global y las migraciones.
+ *
+ *   EvoLLM --steady-state <escenario> [--evaluations N] [--threads T] [--hv-interval N]
+ *          [--population P] [--seed S] [--policies FIFO,LTP]
+ *       Motor estacionario asíncrono (sin barreras de generación) con un presupuesto
+ *       de evaluaciones; imprime el historial de hipervolumen (una fila cada N
+ *       evaluaciones integradas, más la final).
+ *
+ *   EvoLLM --batch <directorio> [--seeds N] [--base-seed S] [--policy-sets "FIFO,LTP;STP"]
+ *          [--generations G] [--population P] [--jobs J] [--out resumen.csv]
+ *          [--adaptive-rates]
+ *       Campaña escenario × semilla × políticas en paralelo, con resumen CSV.
+ *
+ *   EvoLLM --check-determinism <directorio> [--seed S] [--generations G] [--population P]
+ *       Verifica que el modo determinista da el mismo frente con 1, 8 y 64 hilos
+ *       en cada escenario del directorio (código de salida 1 si alguno difiere).
+ *
+ *   EvoLLM --check-scheduler <grafos> [--threads T]
+ *       Ejecuta muchos grafos pequeños seguidos en el planificador de tareas y
+ *       verifica dependencias, ejecución única y excepciones (código 1 si falla).
+ *
+ *   EvoLLM --benchmark <escenario> [--seconds S] [--generations G] [--population P]
+ *          [--threads T] [--seed S] [--policies FIFO,LTP] [--pipelined]
+ *       Una corrida con presupuesto; imprime cada segundo el rendimiento del motor
+ *       (evaluaciones/s, generaciones/s, ms por fase, ETA) para dimensionar hardware
+ *       y comparar versiones. Con --pipelined usa la generación en tubería, que
+ *       además cambia el algoritmo: solo se mutan los hijos y los supervivientes
+ *       no se reevalúan.
+ *
+ *   EvoLLM --island-worker <clave> <isla>
+ *       Proceso trabajador (lo lanza el coordinador, no se usa a mano).
+ */
+
+/** @brief true si los argumentos piden un modo sin interfaz (se decide antes de crear QApplication) */
+bool isHeadlessInvocation(int argc, char* argv[]);
+
+/**
+ * @brief Ejecuta el modo sin interfaz indicado por los argumentos
+ * @return Código de salida del proceso
+ */
+int runHeadless(const QStringList& arguments);
+
+#endif // HEADLESS_H
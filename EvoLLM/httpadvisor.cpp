@@ -0,0 +1,202 @@
+#include "httpadvisor.h"
+
+#include <QDebug>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <algorithm>
+
+namespace {
+
+const char* kGeminiBaseUrl = "https://generativelanguage.googleapis.com/v1beta";
+const char* kGeminiModel = "gemini-2.5-flash";
+const char* kOpenAIBaseUrl = "https://api.openai.com/v1";
+const char* kOpenAIModel = "gpt-4o-mini";
+
+} // namespace
+
+HttpAdvisor::HttpAdvisor(const AdvisorSettings& settings, QObject* parent)
+    : HyperparameterAdvisor(settings, parent),
+    network(new QNetworkAccessManager(this)) {
+}
+
+HttpAdvisor::~HttpAdvisor() {
+    cancel();
+}
+
+QString HttpAdvisor::name() const {
+    return endpoint().toString();
+}
+
+bool HttpAdvisor::isBusy() const {
+    return !reply.isNull();
+}
+
+void HttpAdvisor::cancel() {
+    if (reply) {
+        // Sin finished() hacia onFinished(): abandonar no es un fallo que reportar
+        disconnect(reply, nullptr, this, nullptr);
+        reply->abort();
+        reply->deleteLater();
+        reply = nullptr;
+    }
+}
+
+// ================= Petición =================
+
+QUrl HttpAdvisor::endpoint() const {
+    const bool gemini = config.backend == AdvisorBackend::Gemini;
+
+    QString base = config.baseUrl.isEmpty() ? QString(gemini ? kGeminiBaseUrl : kOpenAIBaseUrl)
+                                            : config.baseUrl;
+    while (base.endsWith('/')) {
+        base.chop(1);
+    }
+    const QString model = config.model.isEmpty() ? QString(gemini ? kGeminiModel : kOpenAIModel)
+                                                 : config.model;
+
+    return gemini ? QUrl(QString("%1/models/%2:generateContent").arg(base, model))
+                  : QUrl(QString("%1/chat/completions").arg(base));
+}
+
+QByteArray HttpAdvisor::requestBody(const QString& prompt) const {
+    QJsonObject rootObj;
+
+    if (config.backend == AdvisorBackend::Gemini) {
+        QJsonObject partObj;
+        partObj["text"] = prompt;
+
+        QJsonArray partsArray;
+        partsArray.append(partObj);
+
+        QJsonObject contentObj;
+        contentObj["parts"] = partsArray;
+
+        QJsonArray contentsArray;
+        contentsArray.append(contentObj);
+
+        QJsonObject generationConfig;
+        generationConfig["temperature"] = config.temperature;
+
+        rootObj["contents"] = contentsArray;
+        rootObj["generationConfig"] = generationConfig;
+    } else {
+        QJsonObject message;
+        message["role"] = "user";
+        message["content"] = prompt;
+
+        QJsonArray messages;
+        messages.append(message);
+
+        rootObj["model"] = config.model.isEmpty() ? QString(kOpenAIModel) : config.model;
+        rootObj["messages"] = messages;
+        rootObj["temperature"] = config.temperature;
+    }
+
+    return QJsonDocument(rootObj).toJson();
+}
+
+void HttpAdvisor::request(const AdviceContext& context) {
+    if (isBusy()) {
+        return;
+    }
+
+    QNetworkRequest request(endpoint());
+    request.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+    if (!config.apiKey.isEmpty()) {
+        if (config.backend == AdvisorBackend::Gemini) {
+            request.setRawHeader("x-goog-api-key", config.apiKey.toUtf8());
+        } else {
+            request.setRawHeader("Authorization", "Bearer " + config.apiKey.toUtf8());
+        }
+    }
+    if (config.timeoutMs > 0) {
+        request.setTransferTimeout(config.timeoutMs);
+    }
+
+    const QString prompt = buildAdvicePrompt(context, config);
+    qDebug() << "Prompt:" << prompt;
+
+    pendingGeneration = context.generation;
+    pendingMutationRates = context.mutationRates;
+    pendingCrossoverRate = context.crossoverRate;
+
+    clock.start();
+    reply = network->post(request, requestBody(prompt));
+    connect(reply, &QNetworkReply::finished, this, &HttpAdvisor::onFinished);
+}
+
+// ================= Respuesta =================
+
+QString HttpAdvisor::extractGeneratedText(AdvisorBackend backend, const QByteArray& response) {
+    QString generatedText;
+
+    // Parse JSON
+    QJsonDocument jsonDoc = QJsonDocument::fromJson(response);
+    if (!jsonDoc.isObject()) {
+        return generatedText;
+    }
+    QJsonObject obj = jsonDoc.object();
+
+    if (backend == AdvisorBackend::Gemini) {
+        QJsonArray candidates = obj["candidates"].toArray();
+        if (!candidates.isEmpty()) {
+            QJsonObject firstCandidate = candidates[0].toObject();
+            QJsonObject content = firstCandidate["content"].toObject();
+            QJsonArray parts = content["parts"].toArray();
+            if (!parts.isEmpty()) {
+                generatedText = parts[0].toObject()["text"].toString();
+            }
+        }
+    } else {
+        QJsonArray choices = obj["choices"].toArray();
+        if (!choices.isEmpty()) {
+            generatedText = choices[0].toObject()["message"].toObject()["content"].toString();
+        }
+    }
+
+    return generatedText;
+}
+
+void HttpAdvisor::onFinished() {
+    QNetworkReply* finishedReply = reply;
+    reply = nullptr;
+    if (!finishedReply) {
+        return;
+    }
+    finishedReply->deleteLater();
+
+    const qint64 latencyMs = clock.elapsed();
+
+    if (finishedReply->error() != QNetworkReply::NoError) {
+        const QString error = finishedReply->error() == QNetworkReply::OperationCanceledError
+                                  ? QString("tiempo agotado (%1 ms)").arg(config.timeoutMs)
+                                  : finishedReply->errorString();
+        emit adviceFailed(pendingGeneration, error, latencyMs);
+        return;
+    }
+
+    const QString response = extractGeneratedText(config.backend, finishedReply->readAll());
+    qDebug() << "Respuesta del modelo:" << response;
+
+    AdviceResult advice;
+    advice.generation = pendingGeneration;
+    advice.mutationRates = pendingMutationRates;
+    advice.crossoverRate = pendingCrossoverRate;
+    advice.latencyMs = latencyMs;
+    if (!parseHyperparametersFromString(response, advice.mutationRates, advice.crossoverRate)) {
+        emit adviceFailed(pendingGeneration, "respuesta sin los 4 valores", latencyMs);
+        return;
+    }
+
+    // El modelo no siempre respeta el rango que se le pide
+    for (float& rate : advice.mutationRates) {
+        rate = std::min(std::max(rate, config.minMutation), config.maxMutation);
+    }
+    advice.crossoverRate = std::min(std::max(advice.crossoverRate, config.minCrossover), config.maxCrossover);
+
+    emit adviceReady(advice);
+}
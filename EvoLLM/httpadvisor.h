@@ -0,0 +1,52 @@
+#ifndef HTTP_ADVISOR_H
+#define HTTP_ADVISOR_H
+
+#include <QPointer>
+#include <QElapsedTimer>
+#include <QUrl>
+#include "hyperparameteradvisor.h"
+
+class QNetworkAccessManager;
+class QNetworkReply;
+
+/**
+ * @brief Consejero que consulta un LLM por HTTP (Gemini u OpenAI compatible)
+ *
+ * Con Gemini usa {baseUrl}/models/{model}:generateContent; con OpenAI usa
+ * {baseUrl}/chat/completions, el formato que exponen también los servidores de
+ * inferencia locales. La URL base, el modelo y la clave salen de la configuración,
+ * así que puede apuntar a un servidor local o a un stub sin salida a internet.
+ *
+ * Cada petición tiene su propio límite de tiempo (timeoutMs) y mide su latencia.
+ * Debe crearse en el hilo que la usa: la respuesta llega por su bucle de eventos.
+ */
+class HttpAdvisor : public HyperparameterAdvisor {
+    Q_OBJECT
+
+public:
+    explicit HttpAdvisor(const AdvisorSettings& settings, QObject* parent = nullptr);
+    ~HttpAdvisor() override;
+
+    QString name() const override;
+    void request(const AdviceContext& context) override;
+    bool isBusy() const override;
+    void cancel() override;
+
+    /** @brief Texto generado dentro de una respuesta JSON de Gemini u OpenAI (vacío si no hay) */
+    static QString extractGeneratedText(AdvisorBackend backend, const QByteArray& response);
+
+private:
+    QNetworkAccessManager* network = nullptr;
+    QPointer<QNetworkReply> reply;
+    QElapsedTimer clock;                    // Latencia de la petición en curso
+
+    int pendingGeneration = 0;
+    QVector<float> pendingMutationRates;    // Vigentes al pedir: base si la respuesta trae menos
+    float pendingCrossoverRate = 0.0f;
+
+    QUrl endpoint() const;
+    QByteArray requestBody(const QString& prompt) const;
+    void onFinished();
+};
+
+#endif // HTTP_ADVISOR_H
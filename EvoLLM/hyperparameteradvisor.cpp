@@ -0,0 +1,215 @@
+#include "hyperparameteradvisor.h"
+#include "httpadvisor.h"
+#include "promptdigest.h"
+
+#include <QDebug>
+#include <QSettings>
+#include <QStringList>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Últimos 20 hipervolúmenes por política (modo de contenido completo)
+QString hypervolumeStringLast20(const QVector<QVector<double>>& hypervolumes,
+                                const QVector<QString>& policyNames)
+{
+    if (hypervolumes.isEmpty() || policyNames.isEmpty())
+        return QString();
+
+    int numPolicies = policyNames.size();
+    QString result;
+
+    // Recorrer cada política
+    for (int c = 0; c < numPolicies; ++c) {
+        QVector<double> last20;
+
+        // Tomar hasta los últimos 20 de la política c
+        for (int g = qMax<qsizetype>(0, hypervolumes.size() - 20); g < hypervolumes.size(); ++g) {
+            if (c < hypervolumes[g].size())
+                last20.append(hypervolumes[g][c]);
+        }
+
+        // Convertir QVector<double> a QString separado por comas
+        QStringList strList;
+        for (double val : last20)
+            strList << QString::number(val, 'f', 4);
+
+        result += QString("%1: [%2]\n")
+                      .arg(policyNames[c])
+                      .arg(strList.join(", "));
+    }
+
+    return result;
+}
+
+AdvisorBackend parseBackend(const QString& name) {
+    const QString key = name.trimmed().toLower();
+    if (key == "none" || key == "noop" || key == "ninguno") {
+        return AdvisorBackend::None;
+    }
+    if (key == "openai") {
+        return AdvisorBackend::OpenAI;
+    }
+    if (key != "gemini") {
+        qWarning() << "Advisor/Backend desconocido:" << name << "- se usa gemini";
+    }
+    return AdvisorBackend::Gemini;
+}
+
+} // namespace
+
+// ================= Configuración =================
+
+AdvisorSettings loadAdvisorSettings(const QString& path) {
+    QSettings ini(path, QSettings::IniFormat);
+    AdvisorSettings settings;
+
+    settings.backend = parseBackend(ini.value("Advisor/Backend", "gemini").toString());
+    settings.baseUrl = ini.value("Advisor/BaseUrl", "").toString().trimmed();
+    settings.model = ini.value("Advisor/Model", "").toString().trimmed();
+    settings.apiKey = ini.value("Advisor/ApiKey", ini.value("API/GeminiKey", "")).toString().trimmed();
+    settings.timeoutMs = ini.value("Advisor/TimeoutMs", settings.timeoutMs).toInt();
+    settings.maxStaleGenerations = ini.value("Advisor/MaxStaleGenerations", settings.maxStaleGenerations).toInt();
+    return settings;
+}
+
+// ================= Prompt =================
+
+QString buildAdvicePrompt(const AdviceContext& context, const AdvisorSettings& settings)
+{
+    // ============================
+    // Datos de la corrida
+    // ============================
+    QString hypervolumeText;
+    QString solutionsText;
+    if (settings.fullScenarioPrompt) {
+        hypervolumeText = hypervolumeStringLast20(context.hypervolumes, context.policyNames);
+        solutionsText = QString("Punto de rodilla:\n%1\nMejor makespan:\n%2\nMejor energía:\n%3")
+                            .arg(context.kneePoint.toString(true))
+                            .arg(context.bestMakespan.toString(true))
+                            .arg(context.bestEnergy.toString(true));
+    } else {
+        hypervolumeText = hypervolumeTrendDigest(context.hypervolumes,
+                                                 context.hypervolumeStats, context.policyNames);
+        solutionsText = frontDigest(context.policyNames, context.kneePoint, context.bestMakespan,
+                                    context.bestEnergy, context.frontSizes);
+    }
+
+    const QVector<float>& mutationRates = context.mutationRates;
+
+    // ============================
+    // Construir el prompt
+    // ============================
+    QString prompt = QString(R"(Eres un asistente experto en optimización de algoritmos genéticos para planificación de tareas.
+    Tu tarea es sugerir los hiperparámetros de un algoritmo genético basado en los resultados de cada generación en un escenario de máquinas y operaciones.
+
+    El escenario es el siguiente:
+
+    %1
+
+    A continuación, te proporcionaré los resultados de la evolución del algoritmo genético y los anteriores hiperparámetros:
+
+    - Hipervolumen por generación:
+    %2
+    - Soluciones actuales:
+    %3
+    - MutationRate InterChromosome: %4
+    - MutationRate ReciprocalExchange: %5
+    - MutationRate Shift: %6
+    - CrossoverRate: %7
+
+    Con base en estos resultados, sugiere los valores óptimos de los hiperparámetros para la siguiente ejecución del algoritmo genético:
+
+    - MutationRate para InterChromosome, ReciprocalExchange, Shift
+    - CrossoverRate
+
+    Devuelve únicamente una lista con 4 valores, en el siguiente orden y formato:
+
+    [InterChromosome, ReciprocalExchange, Shift, crossoverRate]
+
+    Las mutaciones puede ir de %8 a %9 y el crossoverRate puede ir de %10 a %11
+
+    No agregues explicaciones ni texto adicional. Solo devuelve la lista con los valores sugeridos.)")
+                         .arg(context.scenarioText)
+                         .arg(hypervolumeText)
+                         .arg(solutionsText)
+                         .arg(mutationRates[InterChromosome])
+                         .arg(mutationRates[ReciprocalExchange])
+                         .arg(mutationRates[Shift])
+                         .arg(context.crossoverRate)
+                         .arg(settings.minMutation)
+                         .arg(settings.maxMutation)
+                         .arg(settings.minCrossover)
+                         .arg(settings.maxCrossover);
+
+    return prompt;
+}
+
+// ================= Respuesta =================
+
+// Formato que pide el prompt: [InterChromosome, ReciprocalExchange, Shift, crossoverRate].
+// Solo escribe en las salidas si los cuatro valores son números finitos.
+bool parseHyperparametersFromString(
+    const QString& str,
+    QVector<float>& mutationRates,
+    float& crossoverRate)
+{
+    // Quitar corchetes y espacios
+    QString clean = str;
+    clean.remove('[');
+    clean.remove(']');
+    clean = clean.trimmed();
+
+    // Separar por coma
+    QStringList tokens = clean.split(',', Qt::SkipEmptyParts);
+
+    if (tokens.size() != 4) {
+        qWarning() << "Error: se esperaban 4 valores en el string";
+        return false;
+    }
+
+    // Convertir a float
+    const char* names[] = { "InterChromosome", "ReciprocalExchange", "Shift", "crossoverRate" };
+    float values[4];
+    for (int i = 0; i < 4; ++i) {
+        bool ok;
+        values[i] = tokens[i].trimmed().toFloat(&ok);
+        if (!ok) {
+            qWarning() << "Error al convertir" << names[i];
+            return false;
+        }
+        // toFloat acepta "nan" e "inf", y NaN atraviesa cualquier recorte min/max
+        if (!std::isfinite(values[i])) {
+            qWarning() << "Valor no finito en" << names[i];
+            return false;
+        }
+    }
+
+    mutationRates[InterChromosome]    = values[0];
+    mutationRates[ReciprocalExchange] = values[1];
+    mutationRates[Shift]              = values[2];
+    crossoverRate                     = values[3];
+    return true;
+}
+
+// ================= Consejeros =================
+
+HyperparameterAdvisor::HyperparameterAdvisor(const AdvisorSettings& settings, QObject* parent)
+    : QObject(parent),
+    config(settings) {
+}
+
+std::unique_ptr<HyperparameterAdvisor> createAdvisor(const AdvisorSettings& settings, QObject* parent) {
+    if (settings.backend == AdvisorBackend::None) {
+        return std::make_unique<NoOpAdvisor>(settings, parent);
+    }
+
+    // El servicio público de Gemini no responde sin clave; un servidor propio puede no pedirla
+    if (settings.backend == AdvisorBackend::Gemini && settings.apiKey.isEmpty() && settings.baseUrl.isEmpty()) {
+        qWarning() << "ERROR: API key no encontrada en config.ini; la corrida sigue sin consejero";
+        return std::make_unique<NoOpAdvisor>(settings, parent);
+    }
+
+    return std::make_unique<HttpAdvisor>(settings, parent);
+}
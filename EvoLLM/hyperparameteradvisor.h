@@ -0,0 +1,154 @@
+#ifndef HYPERPARAMETER_ADVISOR_H
+#define HYPERPARAMETER_ADVISOR_H
+
+#include <QObject>
+#include <QVector>
+#include <QString>
+#include <memory>
+#include "EvolutionaryAlgorithm.h"      // HypervolumeStats, MutationType
+
+/**
+ * @file HyperparameterAdvisor.h
+ * @brief Interfaz de los consejeros de hiperparámetros (LLM u otros) y su configuración
+ */
+
+/**
+ * @brief Servicio al que se piden los hiperparámetros
+ */
+enum class AdvisorBackend {
+    None,                                   // Sin consejero: la corrida conserva sus tasas
+    Gemini,                                 // API generateContent de Google Gemini
+    OpenAI                                  // API chat/completions (OpenAI, servidores locales compatibles)
+};
+
+/**
+ * @brief Configuración de un consejero (sección [Advisor] de config.ini más la interfaz)
+ */
+struct AdvisorSettings {
+    AdvisorBackend backend = AdvisorBackend::Gemini;
+    QString baseUrl;                        // Vacío = el del proveedor; sirve para un servidor local
+    QString model;                          // Vacío = el predeterminado del proveedor
+    QString apiKey;                         // Opcional con un servidor local
+    double temperature = 0.7;
+
+    int timeoutMs = 30000;                  // Por llamada; al vencer la consulta cuenta como fallida
+    int maxStaleGenerations = 0;            // Consejo con más generaciones de retraso se descarta (0 = sin límite)
+
+    bool fullScenarioPrompt = false;        // Archivo y genes completos en vez de resúmenes
+
+    // Rango permitido; lo sugerido se recorta a estos límites
+    float minMutation = 0.0f;
+    float maxMutation = 1.0f;
+    float minCrossover = 0.0f;
+    float maxCrossover = 1.0f;
+};
+
+/**
+ * @brief Lee la sección [Advisor] de un archivo INI
+ *
+ * Claves: Backend (gemini, openai o none), BaseUrl, Model, ApiKey, TimeoutMs y
+ * MaxStaleGenerations. Si falta ApiKey se usa la clave anterior API/GeminiKey.
+ */
+AdvisorSettings loadAdvisorSettings(const QString& path);
+
+/**
+ * @brief Estado de la corrida en un punto de consulta (lo que el consejero puede ver)
+ */
+struct AdviceContext {
+    int generation = 0;
+    QVector<QString> policyNames;
+    QString scenarioText;                   // Resumen del escenario, o el archivo completo
+    QVector<QVector<double>> hypervolumes;  // Últimas generaciones
+    QVector<HypervolumeStats> hypervolumeStats;
+    Individual kneePoint = Individual({});
+    Individual bestMakespan = Individual({});
+    Individual bestEnergy = Individual({});
+    QVector<int> frontSizes;
+    QVector<float> mutationRates;
+    float crossoverRate = 0.0f;
+};
+
+/**
+ * @brief Hiperparámetros sugeridos para un punto de consulta
+ */
+struct AdviceResult {
+    int generation = 0;                     // Punto de consulta que los pidió
+    QVector<float> mutationRates;
+    float crossoverRate = 0.0f;
+    qint64 latencyMs = 0;                   // Desde la petición hasta la respuesta
+};
+
+/**
+ * @brief Construye el prompt del consejo (resúmenes, o contenido completo si se pide)
+ */
+QString buildAdvicePrompt(const AdviceContext& context, const AdvisorSettings& settings);
+
+/**
+ * @brief Lee la respuesta del modelo: [InterChromosome, ReciprocalExchange, Shift, crossoverRate]
+ *
+ * Solo escribe en las salidas si los cuatro valores son números finitos ("nan" e
+ * "inf" se rechazan: el recorte al rango no los detendría).
+ */
+bool parseHyperparametersFromString(const QString& str,
+                                    QVector<float>& mutationRates,
+                                    float& crossoverRate);
+
+/**
+ * @brief Fuente asíncrona de hiperparámetros para los puntos de consulta
+ *
+ * La usa EvolutionRunner en su hilo: request() no bloquea y la respuesta llega
+ * después con adviceReady() o adviceFailed(), mientras la evolución sigue. Cada
+ * consejero atiende una petición a la vez.
+ */
+class HyperparameterAdvisor : public QObject {
+    Q_OBJECT
+
+public:
+    explicit HyperparameterAdvisor(const AdvisorSettings& settings, QObject* parent = nullptr);
+
+    /** @brief Nombre para los registros */
+    virtual QString name() const = 0;
+
+    /** @brief Pide consejo sin bloquear (se ignora si ya hay una petición en curso) */
+    virtual void request(const AdviceContext& context) = 0;
+
+    /** @brief Hay una petición sin respuesta */
+    virtual bool isBusy() const = 0;
+
+    /** @brief Abandona la petición en curso sin emitir nada */
+    virtual void cancel() = 0;
+
+    const AdvisorSettings& settings() const { return config; }
+
+signals:
+    void adviceReady(const AdviceResult& advice);
+    void adviceFailed(int generation, const QString& error, qint64 latencyMs);
+
+protected:
+    AdvisorSettings config;
+};
+
+/**
+ * @brief Consejero que nunca responde: la corrida mantiene sus tasas
+ */
+class NoOpAdvisor : public HyperparameterAdvisor {
+    Q_OBJECT
+
+public:
+    using HyperparameterAdvisor::HyperparameterAdvisor;
+
+    QString name() const override { return "ninguno"; }
+    void request(const AdviceContext&) override {}
+    bool isBusy() const override { return false; }
+    void cancel() override {}
+};
+
+/**
+ * @brief Crea el consejero indicado por la configuración
+ *
+ * Devuelve NoOpAdvisor con backend None, o con Gemini sin clave ni servidor propio.
+ */
+std::unique_ptr<HyperparameterAdvisor> createAdvisor(const AdvisorSettings& settings,
+                                                     QObject* parent = nullptr);
+
+#endif // HYPERPARAMETER_ADVISOR_H
@@ -0,0 +1,79 @@
+#include "hypervolumetablemodel.h"
+#include <algorithm>
+#include <cmath>
+
+HypervolumeTableModel::HypervolumeTableModel(QObject* parent)
+    : QAbstractTableModel(parent) {
+}
+
+int HypervolumeTableModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : rows.size();
+}
+
+int HypervolumeTableModel::columnCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant HypervolumeTableModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() >= rows.size()) {
+        return QVariant();
+    }
+
+    const Row& row = rows[index.row()];
+
+    if (role == Qt::TextAlignmentRole && index.column() != PolicyColumn) {
+        return int(Qt::AlignRight | Qt::AlignVCenter);
+    }
+    if (role != Qt::DisplayRole) {
+        return QVariant();
+    }
+
+    switch (index.column()) {
+    case GenerationColumn: return row.generation;
+    case PolicyColumn:     return row.policy;
+    case CurrentColumn:    return QString::number(row.stats.last, 'f', 4);
+    case MinColumn:        return QString::number(row.stats.min, 'f', 4);
+    case MaxColumn:        return QString::number(row.stats.max, 'f', 4);
+    case MeanColumn:       return QString::number(row.stats.mean, 'f', 4);
+    case StdDevColumn:     return QString::number(std::sqrt(row.stats.variance()), 'f', 4);
+    default:               return QVariant();
+    }
+}
+
+QVariant HypervolumeTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+
+    switch (section) {
+    case GenerationColumn: return "Generación";
+    case PolicyColumn:     return "Política";
+    case CurrentColumn:    return "Actual";
+    case MinColumn:        return "Min";
+    case MaxColumn:        return "Max";
+    case MeanColumn:       return "Promedio";
+    case StdDevColumn:     return "Desv. estándar";
+    default:               return QVariant();
+    }
+}
+
+void HypervolumeTableModel::appendCheckpoint(int generation,
+                                             const QVector<QString>& policyNames,
+                                             const QVector<HypervolumeStats>& stats) {
+    const int count = std::min(policyNames.size(), stats.size());
+    if (count == 0) {
+        return;
+    }
+
+    beginInsertRows(QModelIndex(), rows.size(), rows.size() + count - 1);
+    for (int c = 0; c < count; ++c) {
+        rows.append({generation, policyNames[c], stats[c]});
+    }
+    endInsertRows();
+}
+
+void HypervolumeTableModel::clear() {
+    beginResetModel();
+    rows.clear();
+    endResetModel();
+}
@@ -0,0 +1,59 @@
+#ifndef HYPERVOLUMETABLEMODEL_H
+#define HYPERVOLUMETABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QVector>
+#include <QString>
+#include "EvolutionaryAlgorithm.h"      // HypervolumeStats
+
+/**
+ * @brief Modelo de tabla con el historial de hipervolúmenes de una corrida
+ *
+ * Sustituye a las QTableWidget que se creaban en cada punto de consulta: hay una
+ * sola vista (QTableView) y cada punto agrega una fila por política. Las
+ * estadísticas ya llegan calculadas desde el motor, así que agregar un punto cuesta
+ * O(número de políticas) sin importar cuántas generaciones lleve la corrida, y la
+ * vista solo pide los datos de las filas visibles.
+ */
+class HypervolumeTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Column {
+        GenerationColumn,
+        PolicyColumn,
+        CurrentColumn,
+        MinColumn,
+        MaxColumn,
+        MeanColumn,
+        StdDevColumn,
+        ColumnCount
+    };
+
+    explicit HypervolumeTableModel(QObject* parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    /** @brief Agrega una fila por política con las estadísticas en esa generación */
+    void appendCheckpoint(int generation,
+                          const QVector<QString>& policyNames,
+                          const QVector<HypervolumeStats>& stats);
+
+    /** @brief Vacía el historial (al iniciar una corrida nueva) */
+    void clear();
+
+private:
+    struct Row {
+        int generation;
+        QString policy;
+        HypervolumeStats stats;
+    };
+
+    QVector<Row> rows;
+};
+
+#endif // HYPERVOLUMETABLEMODEL_H
@@ -13,7 +13,7 @@ Individual::Individual(const QVector<QString>& policyNames) {
 void Individual::initializeRandom(int chromosomeSize,
                                   int minValue,
                                   int maxValue,
-                                  QRandomGenerator& rng) {
+                                  Rng& rng) {
     for (Chromosome& chromosome : chromosomes) {
         chromosome.initializeRandom(chromosomeSize, minValue, maxValue, rng);
     }
@@ -3,7 +3,7 @@
 
 #include <QVector>
 #include <QString>
-#include <QRandomGenerator>
+#include "rng.h"
 #include "Chromosome.h"
 
 /**
@@ -39,7 +39,7 @@ public:
     void initializeRandom(int chromosomeSize,
                          int minValue,
                          int maxValue,
-                         QRandomGenerator& rng);
+                         Rng& rng);
 
     /**
      * @brief Devuelve cuántos cromosomas contiene este individuo
@@ -0,0 +1,118 @@
+#include "individualcodec.h"
+
+#include <cstdint>
+#include <cstring>
+
+// ================= Formato =================
+
+namespace {
+
+const int kHeaderBytes = 4 + 2 + 2 + 4;
+const int kFitnessBytes = 8 + 8 + 4 + 8;
+
+int chromosomeBytes(int geneCount) {
+    return kFitnessBytes + 2 * geneCount;
+}
+
+template <typename T>
+char* put(char* out, T value) {
+    std::memcpy(out, &value, sizeof(T));
+    return out + sizeof(T);
+}
+
+template <typename T>
+const char* get(const char* in, T& value) {
+    std::memcpy(&value, in, sizeof(T));
+    return in + sizeof(T);
+}
+
+} // namespace
+
+int encodedIndividualsSize(int count, int numChromosomes, int geneCount) {
+    return kHeaderBytes + count * numChromosomes * chromosomeBytes(geneCount);
+}
+
+// ================= Codificación =================
+
+QByteArray encodeIndividuals(const QVector<Individual>& individuals) {
+    const int count = individuals.size();
+    const int numChromosomes = count > 0 ? individuals[0].getNumChromosomes() : 0;
+    const int geneCount = numChromosomes > 0 ? individuals[0].chromosomes[0].genes.size() : 0;
+
+    QByteArray buffer(encodedIndividualsSize(count, numChromosomes, geneCount), Qt::Uninitialized);
+    char* out = buffer.data();
+
+    out = put<std::uint32_t>(out, count);
+    out = put<std::uint16_t>(out, numChromosomes);
+    out = put<std::uint16_t>(out, 0);
+    out = put<std::uint32_t>(out, geneCount);
+
+    for (const Individual& ind : individuals) {
+        for (const Chromosome& chrom : ind.chromosomes) {
+            out = put<double>(out, chrom.f1);
+            out = put<double>(out, chrom.f2);
+            out = put<std::int32_t>(out, chrom.domLevel);
+            out = put<double>(out, chrom.crowdingDistance);
+            for (int g = 0; g < geneCount; ++g) {
+                out = put<std::uint16_t>(out, static_cast<std::uint16_t>(chrom.genes[g]));
+            }
+        }
+    }
+
+    return buffer;
+}
+
+// ================= Decodificación =================
+
+bool decodeIndividuals(const char* data,
+                       int size,
+                       const QVector<QString>& policyNames,
+                       QVector<Individual>& out) {
+    out.clear();
+    if (size < kHeaderBytes) {
+        return false;
+    }
+
+    std::uint32_t count;
+    std::uint16_t numChromosomes;
+    std::uint16_t reserved;
+    std::uint32_t geneCount;
+
+    const char* in = data;
+    in = get(in, count);
+    in = get(in, numChromosomes);
+    in = get(in, reserved);
+    in = get(in, geneCount);
+
+    if (count > 0 && numChromosomes != policyNames.size()) {
+        return false;
+    }
+    if (size < encodedIndividualsSize(count, numChromosomes, geneCount)) {
+        return false;
+    }
+
+    out.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        Individual ind(policyNames);
+
+        for (Chromosome& chrom : ind.chromosomes) {
+            std::int32_t domLevel;
+            in = get(in, chrom.f1);
+            in = get(in, chrom.f2);
+            in = get(in, domLevel);
+            in = get(in, chrom.crowdingDistance);
+            chrom.domLevel = domLevel;
+
+            chrom.genes.resize(geneCount);
+            for (std::uint32_t g = 0; g < geneCount; ++g) {
+                std::uint16_t gene;
+                in = get(in, gene);
+                chrom.genes[g] = gene;
+            }
+        }
+
+        out.append(ind);
+    }
+
+    return true;
+}
@@ -0,0 +1,42 @@
+#ifndef INDIVIDUAL_CODEC_H
+#define INDIVIDUAL_CODEC_H
+
+#include <QByteArray>
+#include <QVector>
+#include <QString>
+#include "Individual.h"
+
+/**
+ * @file IndividualCodec.h
+ * @brief Codificación binaria compacta de individuos para intercambio entre procesos
+ *
+ * Formato (orden de bytes nativo: emisor y receptor están en la misma máquina):
+ *
+ *   Cabecera: uint32 cantidad | uint16 cromosomas | uint16 reservado | uint32 genes
+ *   Por individuo y cromosoma: double f1 | double f2 | int32 domLevel |
+ *                              double crowdingDistance | uint16 genes[genes]
+ *
+ * Los nombres de política no viajan: ambos extremos conocen la lista y su orden.
+ * Los genes son índices de máquina, así que caben en 16 bits.
+ */
+
+/** @brief Bytes exactos que ocupan 'count' individuos codificados */
+int encodedIndividualsSize(int count, int numChromosomes, int geneCount);
+
+/**
+ * @brief Codifica los individuos (todos con el mismo número de cromosomas y genes)
+ * @return Bloque binario listo para copiar a memoria compartida
+ */
+QByteArray encodeIndividuals(const QVector<Individual>& individuals);
+
+/**
+ * @brief Decodifica un bloque producido por encodeIndividuals()
+ * @param policyNames Políticas en el mismo orden que en el emisor
+ * @return false si el bloque está truncado o no corresponde a las políticas dadas
+ */
+bool decodeIndividuals(const char* data,
+                       int size,
+                       const QVector<QString>& policyNames,
+                       QVector<Individual>& out);
+
+#endif // INDIVIDUAL_CODEC_H
@@ -0,0 +1,201 @@
+#include "islandmodel.h"
+
+#include <QDebug>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+// ================= Constructor =================
+
+IslandModel::IslandModel(std::shared_ptr<const ScenarioData> scenario,
+                         const QVector<QString>& policyNames,
+                         const IslandConfig& config)
+    : scenario(std::move(scenario)),
+    policyNames(policyNames),
+    config(config),
+    seed(config.seed) {
+    if (config.numIslands < 1) {
+        throw std::runtime_error("Island count must be at least 1");
+    }
+    if (config.migrationInterval < 1) {
+        throw std::runtime_error("Migration interval must be at least 1");
+    }
+
+    if (seed == 0) {
+        std::random_device device;
+        seed = (static_cast<std::uint64_t>(device()) << 32) | device();
+    }
+    qDebug() << "Semilla del modelo de islas:" << seed;
+}
+
+// ================= Inicialización =================
+
+void IslandModel::initialize() {
+    islands.clear();
+
+    // Un flujo por isla derivado de la semilla global (saltos de 2^128)
+    Rng master(seed);
+
+    for (int i = 0; i < config.numIslands; ++i) {
+        auto island = std::make_unique<EvolutionaryAlgorithm>(
+            scenario, policyNames, config.populationSize,
+            config.crossoverRate, config.mutationRates, seed);
+        island->setRandomStream(master.split());
+        island->initialize();
+        islands.push_back(std::move(island));
+    }
+
+    buildTopology();
+}
+
+void IslandModel::buildTopology() {
+    const int n = config.numIslands;
+
+    queues.clear();
+    outgoing.assign(n, {});
+    incoming.assign(n, {});
+
+    auto addEdge = [&](int from, int to) {
+        queues.push_back(std::make_unique<MigrantQueue>(config.queueCapacity));
+        outgoing[from].push_back(static_cast<int>(queues.size()) - 1);
+        incoming[to].push_back(static_cast<int>(queues.size()) - 1);
+    };
+
+    if (n < 2) return;
+
+    if (config.topology == RingTopology) {
+        for (int i = 0; i < n; ++i) {
+            addEdge(i, (i + 1) % n);
+        }
+    } else {
+        for (int i = 0; i < n; ++i)
+            for (int j = 0; j < n; ++j)
+                if (i != j) addEdge(i, j);
+    }
+}
+
+// ================= Ejecución =================
+
+void IslandModel::run(int numGenerations) {
+    if (islands.empty()) {
+        initialize();
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(islands.size());
+
+    for (int i = 0; i < static_cast<int>(islands.size()); ++i) {
+        workers.emplace_back(&IslandModel::runIsland, this, i, numGenerations);
+    }
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void IslandModel::runIsland(int index, int numGenerations) {
+    EvolutionaryAlgorithm& island = *islands[index];
+
+    for (int gen = 1; gen <= numGenerations; ++gen) {
+        island.runGeneration();
+
+        if (gen % config.migrationInterval == 0) {
+            migrate(index);
+        }
+    }
+}
+
+void IslandModel::migrate(int index) {
+    EvolutionaryAlgorithm& island = *islands[index];
+
+    // Enviar: si la vecina aún no consumió lo anterior, el lote se descarta
+    if (!outgoing[index].empty()) {
+        QVector<Individual> emigrants = island.getEmigrants(config.migrantsPerExchange);
+        if (!emigrants.isEmpty()) {
+            for (int q : outgoing[index]) {
+                if (queues[q]->tryPush(emigrants)) {
+                    migrationsSent++;
+                } else {
+                    migrationsDropped++;
+                }
+            }
+        }
+    }
+
+    // Recibir todo lo pendiente sin esperar a las demás islas
+    QVector<Individual> immigrants;
+    QVector<Individual> batch;
+    for (int q : incoming[index]) {
+        while (queues[q]->tryPop(batch)) {
+            immigrants += batch;
+        }
+    }
+    island.acceptImmigrants(immigrants);
+}
+
+// ================= Resultados =================
+
+QVector<Individual> IslandModel::getGlobalFront() const {
+    QVector<Individual> merged;
+    for (const auto& island : islands) {
+        merged += island->getPopulation();
+    }
+    return extractGlobalFront(merged);
+}
+
+QVector<Individual> extractGlobalFront(QVector<Individual> merged) {
+    if (merged.isEmpty()) {
+        return merged;
+    }
+
+    const int numChromosomes = merged[0].getNumChromosomes();
+
+    // No dominancia por política sobre la unión de todas las islas
+    for (int c = 0; c < numChromosomes; ++c) {
+        for (int i = 0; i < merged.size(); ++i) {
+            const Chromosome& B = merged[i].chromosomes[c];
+            bool dominated = false;
+
+            for (int j = 0; j < merged.size() && !dominated; ++j) {
+                if (i == j) continue;
+                const Chromosome& A = merged[j].chromosomes[c];
+                dominated = A.f1 <= B.f1 && A.f2 <= B.f2 &&
+                            (A.f1 < B.f1 || A.f2 < B.f2);
+            }
+
+            merged[i].chromosomes[c].domLevel = dominated ? 2 : 1;
+            merged[i].chromosomes[c].crowdingDistance = -1;
+        }
+    }
+
+    QVector<Individual> front;
+    for (const Individual& ind : merged) {
+        for (const Chromosome& chrom : ind.chromosomes) {
+            if (chrom.domLevel == 1) {
+                front.append(ind);
+                break;
+            }
+        }
+    }
+    return front;
+}
+
+int IslandModel::getNumIslands() const {
+    return static_cast<int>(islands.size());
+}
+
+const EvolutionaryAlgorithm& IslandModel::getIsland(int index) const {
+    return *islands[index];
+}
+
+std::uint64_t IslandModel::getSeed() const {
+    return seed;
+}
+
+long long IslandModel::getMigrationsSent() const {
+    return migrationsSent.load();
+}
+
+long long IslandModel::getMigrationsDropped() const {
+    return migrationsDropped.load();
+}
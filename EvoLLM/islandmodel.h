@@ -0,0 +1,104 @@
+#ifndef ISLAND_MODEL_H
+#define ISLAND_MODEL_H
+
+#include <QVector>
+#include <QString>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "EvolutionaryAlgorithm.h"
+#include "spscqueue.h"
+
+/**
+ * @brief Topología de migración entre islas
+ */
+enum MigrationTopology {
+    RingTopology = 0,               // Cada isla envía a la siguiente (i → i+1)
+    FullyConnectedTopology          // Cada isla envía a todas las demás
+};
+
+/**
+ * @brief Parámetros del modelo de islas
+ */
+struct IslandConfig {
+    int numIslands = 4;                     // Número de islas (un hilo por isla)
+    int migrationInterval = 10;             // Se migra cada K generaciones
+    int migrantsPerExchange = 2;            // Emigrantes enviados por arista y migración
+    int queueCapacity = 4;                  // Lotes de migrantes en espera por arista
+    MigrationTopology topology = RingTopology;
+
+    int populationSize = 50;                // Tamaño de población de CADA isla
+    float crossoverRate = 0.8f;
+    QVector<float> mutationRates = QVector<float>(MutationCount, 0.1f);
+
+    std::uint64_t seed = 0;                 // Semilla global (0 = aleatoria, se reporta)
+};
+
+/**
+ * @brief Frente global de la unión de varias poblaciones: individuos no dominados
+ * en al menos una política. En el resultado, domLevel == 1 marca los cromosomas
+ * del frente global (el resto queda con domLevel == 2).
+ */
+QVector<Individual> extractGlobalFront(QVector<Individual> merged);
+
+/**
+ * @brief Evolución paralela por islas con migración periódica
+ *
+ * Ejecuta N instancias de EvolutionaryAlgorithm en hilos separados, todas
+ * compartiendo el mismo ScenarioData inmutable. Cada K generaciones, cada isla
+ * envía sus mejores individuos no dominados a sus vecinas mediante colas SPSC
+ * sin bloqueos y recibe los que tenga pendientes (no hay barreras entre islas).
+ *
+ * Al final, las poblaciones se combinan en un frente global.
+ */
+class IslandModel {
+public:
+    IslandModel(std::shared_ptr<const ScenarioData> scenario,
+                const QVector<QString>& policyNames,
+                const IslandConfig& config);
+
+    /** Crea e inicializa todas las islas (flujos aleatorios independientes) */
+    void initialize();
+
+    /**
+     * @brief Ejecuta 'numGenerations' generaciones en todas las islas en paralelo
+     * Bloquea hasta que todas las islas terminan.
+     */
+    void run(int numGenerations);
+
+    /**
+     * @brief Frente global: individuos no dominados (en al menos una política)
+     * considerando las poblaciones de todas las islas juntas.
+     * En el resultado, domLevel == 1 marca los cromosomas del frente global.
+     */
+    QVector<Individual> getGlobalFront() const;
+
+    int getNumIslands() const;
+    const EvolutionaryAlgorithm& getIsland(int index) const;
+    std::uint64_t getSeed() const;                  // Semilla global usada
+    long long getMigrationsSent() const;            // Lotes entregados a colas
+    long long getMigrationsDropped() const;         // Lotes descartados (cola llena)
+
+private:
+    using MigrantQueue = SpscQueue<QVector<Individual>>;
+
+    std::shared_ptr<const ScenarioData> scenario;
+    QVector<QString> policyNames;
+    IslandConfig config;
+    std::uint64_t seed;
+
+    std::vector<std::unique_ptr<EvolutionaryAlgorithm>> islands;
+    std::vector<std::unique_ptr<MigrantQueue>> queues;  // Una por arista dirigida
+    std::vector<std::vector<int>> outgoing;             // outgoing[i] = colas de salida de la isla i
+    std::vector<std::vector<int>> incoming;             // incoming[i] = colas de entrada de la isla i
+
+    std::atomic<long long> migrationsSent{0};
+    std::atomic<long long> migrationsDropped{0};
+
+    void buildTopology();
+    void runIsland(int index, int numGenerations);
+    void migrate(int index);
+};
+
+#endif // ISLAND_MODEL_H
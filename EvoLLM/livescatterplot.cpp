@@ -0,0 +1,270 @@
+#include "livescatterplot.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// Fracción del camino hacia el rango objetivo que recorre cada cuadro al contraer
+const double kAxisSmoothing = 0.25;
+
+// Por debajo de esta fracción del ancho se considera que el eje ya llegó
+const double kAxisSettled = 0.005;
+
+double approach(double shown, double target, bool growsDown)
+{
+    // Crecer es inmediato: un punto nunca debe quedar fuera de la gráfica
+    if (growsDown ? target < shown : target > shown) {
+        return target;
+    }
+    return shown + (target - shown) * kAxisSmoothing;
+}
+
+} // namespace
+
+// ================= Constructor =================
+
+LiveScatterPlot::LiveScatterPlot(const QString& title, qreal markerSize, QWidget* parent)
+    : DensityChartView(new QChart(), parent)
+    , chart(DensityChartView::chart())
+    , axisX(new QValueAxis())
+    , axisY(new QValueAxis())
+    , markerSize(markerSize)
+{
+    chart->setTitle(title);
+    chart->legend()->setVisible(true);
+
+    axisX->setTitleText("Makespan");
+    axisY->setTitleText("Energía");
+    chart->addAxis(axisX, Qt::AlignBottom);
+    chart->addAxis(axisY, Qt::AlignLeft);
+
+    setRenderHint(QPainter::Antialiasing);
+    setMinimumHeight(600);
+
+    setMaxFrameRate(10);
+    connect(&frameTimer, &QTimer::timeout, this, &LiveScatterPlot::onFrame);
+}
+
+// ================= Configuración =================
+
+void LiveScatterPlot::setSeriesNames(const QVector<QString>& names)
+{
+    frameTimer.stop();
+    chart->removeAllSeries();
+    series.clear();
+    seriesColors.clear();
+    pending.clear();
+    pendingOverlay.clear();
+    clearDensity();
+    dirty = false;
+    hasRange = false;
+    targetRange = QRectF();
+
+    // Misma paleta que ChartPlotter para que las políticas conserven su color
+    QVector<QColor> colors = {
+        Qt::red, Qt::green, Qt::blue,
+        Qt::magenta, Qt::cyan, Qt::yellow, Qt::black
+    };
+
+    for (int s = 0; s < names.size(); ++s) {
+        QScatterSeries* scatter = new QScatterSeries();
+        scatter->setName("Cromosoma " + names[s]);
+        scatter->setMarkerSize(markerSize);
+        scatter->setUseOpenGL(true);    // Miles de puntos por cuadro
+
+        QColor color = colors[s % colors.size()];
+        color.setAlpha(150);
+        scatter->setColor(color);
+        scatter->setBorderColor(color);
+        seriesColors.append(color);
+
+        chart->addSeries(scatter);
+        scatter->attachAxis(axisX);
+        scatter->attachAxis(axisY);
+        series.append(scatter);
+    }
+}
+
+void LiveScatterPlot::setMaxFrameRate(int fps)
+{
+    frameTimer.setInterval(1000 / std::max(1, fps));
+}
+
+void LiveScatterPlot::setAxisMode(AxisMode mode)
+{
+    axisMode = mode;
+    hasRange = false;
+}
+
+void LiveScatterPlot::setFixedRange(const QRectF& range)
+{
+    fixedRange = range;
+    hasRange = false;
+}
+
+// ================= Datos =================
+
+void LiveScatterPlot::setDensityThreshold(int points)
+{
+    densityThreshold = points;
+}
+
+void LiveScatterPlot::setPoints(const QVector<QVector<QPointF>>& points,
+                                const QVector<QVector<QPointF>>& overlay)
+{
+    pending = points;
+    pendingOverlay = overlay;
+    dirty = true;
+
+    // El primer dato se dibuja de inmediato; los siguientes esperan al próximo cuadro
+    if (!frameTimer.isActive()) {
+        onFrame();
+        frameTimer.start();
+    }
+}
+
+void LiveScatterPlot::flush()
+{
+    if (!isVisible()) {
+        return;                             // Se dibuja al mostrarse
+    }
+    if (dirty) {
+        applyPending();
+    }
+    if (axisMode == TrackingAxes && hasRange) {
+        shownRange = targetRange;
+        axisX->setRange(shownRange.left(), shownRange.right());
+        axisY->setRange(shownRange.top(), shownRange.bottom());
+    }
+}
+
+void LiveScatterPlot::showEvent(QShowEvent* event)
+{
+    DensityChartView::showEvent(event);
+
+    // Lo que llegó mientras estaba oculta se dibuja ahora
+    if (dirty && !frameTimer.isActive()) {
+        onFrame();
+        frameTimer.start();
+    }
+}
+
+void LiveScatterPlot::onFrame()
+{
+    // Oculta no se dibuja: los datos quedan pendientes hasta showEvent()
+    if (!isVisible()) {
+        frameTimer.stop();
+        return;
+    }
+
+    if (dirty) {
+        applyPending();
+    }
+
+    // Sin datos nuevos y con los ejes quietos no hace falta seguir despertando
+    if (!updateAxes() && !dirty) {
+        frameTimer.stop();
+    }
+}
+
+void LiveScatterPlot::applyPending()
+{
+    double minX = std::numeric_limits<double>::max();
+    double maxX = std::numeric_limits<double>::lowest();
+    double minY = std::numeric_limits<double>::max();
+    double maxY = std::numeric_limits<double>::lowest();
+
+    const int count = std::min(series.size(), pending.size());
+    qsizetype totalPoints = 0;
+    for (int s = 0; s < count; ++s) {
+        for (const QPointF& p : pending[s]) {
+            minX = std::min(minX, p.x());
+            maxX = std::max(maxX, p.x());
+            minY = std::min(minY, p.y());
+            maxY = std::max(maxY, p.y());
+        }
+        totalPoints += pending[s].size();
+    }
+
+    const bool densityMode = densityThreshold > 0 && totalPoints > densityThreshold;
+
+    // Un solo reemplazo por serie: una única notificación de repintado.
+    // En modo densidad las series solo llevan los puntos destacados.
+    for (int s = 0; s < count; ++s) {
+        series[s]->replace(densityMode ? pendingOverlay.value(s) : pending[s]);
+    }
+    dirty = false;
+
+    if (!densityMode) {
+        clearDensity();
+    }
+
+    if (minX > maxX) {
+        return;                             // Sin puntos: los ejes no cambian
+    }
+
+    // Mismo margen del 5 % que las gráficas estáticas
+    double marginX = (maxX - minX) * 0.05;
+    double marginY = (maxY - minY) * 0.05;
+    if (marginX == 0.0) marginX = std::max(1.0, std::abs(maxX) * 0.05);
+    if (marginY == 0.0) marginY = std::max(1.0, std::abs(maxY) * 0.05);
+
+    targetRange = QRectF(QPointF(minX - marginX, minY - marginY),
+                         QPointF(maxX + marginX, maxY + marginY));
+
+    if (densityMode) {
+        // La imagen se calcula para un rango concreto: aquí los ejes saltan sin suavizado
+        if (axisMode == TrackingAxes) {
+            shownRange = targetRange;
+            hasRange = true;
+            axisX->setRange(shownRange.left(), shownRange.right());
+            axisY->setRange(shownRange.top(), shownRange.bottom());
+        }
+        const QRectF range = axisMode == FixedAxes && fixedRange.isValid() ? fixedRange : targetRange;
+        setDensityData(QVector<QVector<QPointF>>(pending.begin(), pending.begin() + count),
+                       range, seriesColors);
+    }
+}
+
+bool LiveScatterPlot::updateAxes()
+{
+    if (axisMode == FixedAxes) {
+        if (!hasRange && fixedRange.isValid()) {
+            axisX->setRange(fixedRange.left(), fixedRange.right());
+            axisY->setRange(fixedRange.top(), fixedRange.bottom());
+            hasRange = true;
+        }
+        return false;
+    }
+
+    if (targetRange.isNull()) {
+        return false;
+    }
+
+    if (!hasRange) {
+        shownRange = targetRange;
+        hasRange = true;
+    } else {
+        const double left   = approach(shownRange.left(),   targetRange.left(),   true);
+        const double right  = approach(shownRange.right(),  targetRange.right(),  false);
+        const double top    = approach(shownRange.top(),    targetRange.top(),    true);
+        const double bottom = approach(shownRange.bottom(), targetRange.bottom(), false);
+        shownRange = QRectF(QPointF(left, top), QPointF(right, bottom));
+    }
+
+    const double epsX = targetRange.width() * kAxisSettled;
+    const double epsY = targetRange.height() * kAxisSettled;
+    const bool settled =
+        std::abs(shownRange.left() - targetRange.left()) <= epsX &&
+        std::abs(shownRange.right() - targetRange.right()) <= epsX &&
+        std::abs(shownRange.top() - targetRange.top()) <= epsY &&
+        std::abs(shownRange.bottom() - targetRange.bottom()) <= epsY;
+    if (settled) {
+        shownRange = targetRange;
+    }
+
+    axisX->setRange(shownRange.left(), shownRange.right());
+    axisY->setRange(shownRange.top(), shownRange.bottom());
+    return !settled;
+}
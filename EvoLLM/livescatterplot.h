@@ -0,0 +1,102 @@
+#ifndef LIVESCATTERPLOT_H
+#define LIVESCATTERPLOT_H
+
+#include <QtCharts>             // QChartView, QScatterSeries, QValueAxis
+#include "densitychartview.h"   // Mapa de densidad para poblaciones muy grandes
+#include <QTimer>
+#include <QVector>
+#include <QPointF>
+#include <QRectF>
+
+/**
+ * @brief Gráfica de dispersión que se actualiza en vivo durante una corrida
+ *
+ * A diferencia de ChartPlotter::plotPareto/plotPopulation, que reconstruyen el
+ * QChart completo en cada llamada, aquí el chart, los ejes y las series se crean
+ * una sola vez. setPoints() solo guarda los datos más recientes; un temporizador
+ * los vuelca como máximo maxFps veces por segundo con un único
+ * QXYSeries::replace() por serie, así que llamarlo en cada generación no bloquea
+ * la interfaz aunque la población tenga miles de individuos.
+ *
+ * Los ejes pueden quedar fijos o seguir a los datos: crecen de inmediato (ningún
+ * punto queda fuera) y se contraen de forma suave entre cuadros.
+ *
+ * Con setDensityThreshold(), si el total de puntos supera el umbral se pasa a modo
+ * densidad: los puntos van al mapa de densidad (calculado en otro hilo) y las
+ * series solo muestran los puntos "overlay" de setPoints() (el frente de Pareto).
+ *
+ * Mientras la gráfica está oculta (otra pestaña) no se dibuja nada: solo se guardan
+ * los datos más recientes, que se vuelcan al volver a mostrarse.
+ */
+class LiveScatterPlot : public DensityChartView
+{
+    Q_OBJECT
+
+public:
+    enum AxisMode {
+        TrackingAxes,       // Los ejes siguen el rango de los datos
+        FixedAxes           // Los ejes quedan en el rango indicado con setFixedRange()
+    };
+
+    explicit LiveScatterPlot(const QString& title, qreal markerSize, QWidget* parent = nullptr);
+
+    /**
+     * @brief Crea una serie por nombre (solo al empezar una corrida)
+     * Borra los puntos y reinicia los ejes.
+     */
+    void setSeriesNames(const QVector<QString>& names);
+
+    /**
+     * @brief Datos más recientes: points[s] son los puntos de la serie s
+     * No dibuja nada; el siguiente cuadro del temporizador los vuelca.
+     *
+     * @param overlay Puntos que se dibujan como vectores en modo densidad
+     */
+    void setPoints(const QVector<QVector<QPointF>>& points,
+                   const QVector<QVector<QPointF>>& overlay = {});
+
+    /** @brief Total de puntos a partir del cual se usa el mapa de densidad (0 = nunca) */
+    void setDensityThreshold(int points);
+
+    /** @brief Vuelca de inmediato los datos pendientes (por ejemplo, al terminar; oculta no hace nada) */
+    void flush();
+
+    /** @brief Límite de cuadros por segundo (10 por defecto) */
+    void setMaxFrameRate(int fps);
+
+    void setAxisMode(AxisMode mode);
+
+    /** @brief Rango de los ejes en modo FixedAxes (x = makespan, y = energía) */
+    void setFixedRange(const QRectF& range);
+
+protected:
+    void showEvent(QShowEvent* event) override;
+
+private slots:
+    void onFrame();
+
+private:
+    QChart* chart;
+    QValueAxis* axisX;
+    QValueAxis* axisY;
+    QVector<QScatterSeries*> series;
+    QVector<QColor> seriesColors;
+    qreal markerSize;
+
+    QVector<QVector<QPointF>> pending;      // Últimos datos recibidos
+    QVector<QVector<QPointF>> pendingOverlay;
+    int densityThreshold = 0;
+    bool dirty = false;                     // Hay datos que aún no se dibujaron
+
+    QTimer frameTimer;
+    AxisMode axisMode = TrackingAxes;
+    QRectF fixedRange;
+    QRectF shownRange;                      // Rango que muestran los ejes ahora
+    QRectF targetRange;                     // Rango de los datos (con margen)
+    bool hasRange = false;
+
+    void applyPending();
+    bool updateAxes();                      // true si los ejes siguen moviéndose
+};
+
+#endif // LIVESCATTERPLOT_H
@@ -1,9 +1,17 @@
 #include "mainwindow.h"
+#include "headless.h"
 
 #include <QApplication>
+#include <QCoreApplication>
 
 int main(int argc, char *argv[])
 {
+    // Modos sin interfaz (coordinador y trabajadores de islas, etc.)
+    if (isHeadlessInvocation(argc, argv)) {
+        QCoreApplication app(argc, argv);
+        return runHeadless(app.arguments());
+    }
+
     QApplication a(argc, argv);
     MainWindow w;
     w.show();
@@ -15,15 +15,9 @@
 #include <QtCharts/QChart>
 #include <QFileDialog>
 #include <QTableWidget>
+#include <QVBoxLayout>
+#include <QHeaderView>
 #include <QMessageBox>
-#include <QNetworkAccessManager>
-#include <QNetworkRequest>
-#include <QNetworkReply>
-#include <QUrl>
-#include <QJsonDocument>
-#include <QJsonObject>
-#include <QJsonArray>
-#include <QSettings>
 
 
 void clearWidget(QWidget* widget) {
@@ -43,41 +37,6 @@ void clearWidget(QWidget* widget) {
     }
 }
 
-void parseHyperparametersFromString(
-    const QString& str,
-    QVector<float>& mutationRates,
-    float& crossoverRate)
-{
-    // Quitar corchetes y espacios
-    QString clean = str;
-    clean.remove('[');
-    clean.remove(']');
-    clean = clean.trimmed();
-
-    // Separar por coma
-    QStringList tokens = clean.split(',', Qt::SkipEmptyParts);
-
-    if (tokens.size() != 4) {
-        qWarning() << "Error: se esperaban 4 valores en el string";
-        return;
-    }
-
-    // Convertir a float
-    bool ok;
-    mutationRates[ReciprocalExchange] = tokens[0].toFloat(&ok);
-    if (!ok) qWarning() << "Error al convertir ReciprocalExchange";
-
-    mutationRates[Shift] = tokens[1].toFloat(&ok);
-    if (!ok) qWarning() << "Error al convertir Shift";
-
-    mutationRates[InterChromosome] = tokens[2].toFloat(&ok);
-    if (!ok) qWarning() << "Error al convertir InterChromosome";
-
-    crossoverRate = tokens[3].toFloat(&ok);
-    if (!ok) qWarning() << "Error al convertir crossoverRate";
-}
-
-
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
     , ui(new Ui::MainWindow)
@@ -90,21 +49,50 @@ MainWindow::MainWindow(QWidget *parent)
     connect(ui->RRLTPButton,  &QRadioButton::toggled, this, &MainWindow::onPolicyToggled);
     connect(ui->RRECAButton,  &QRadioButton::toggled, this, &MainWindow::onPolicyToggled);
 
-
-    QSettings settings("config.ini", QSettings::IniFormat);
-    apiKey = settings.value("API/GeminiKey", "").toString();
-
-    if (apiKey.isEmpty()) {
-        qDebug() << "ERROR: API key no encontrada en config.ini";
-    }
-
+    // El algoritmo corre en su propio hilo; aquí solo llegan señales encoladas
+    runner = new EvolutionRunner;
+    runner->moveToThread(&workerThread);
+    connect(&workerThread, &QThread::finished, runner, &QObject::deleteLater);
+    connect(runner, &EvolutionRunner::started, this, &MainWindow::onRunStarted);
+    connect(runner, &EvolutionRunner::generationFinished, this, &MainWindow::onGenerationFinished);
+    connect(runner, &EvolutionRunner::checkpointReached, this, &MainWindow::onCheckpointReached);
+    connect(runner, &EvolutionRunner::adviceApplied, this, &MainWindow::onAdviceApplied);
+    connect(runner, &EvolutionRunner::finished, this, &MainWindow::onRunFinished);
+    connect(runner, &EvolutionRunner::cancelled, this, &MainWindow::onRunCancelled);
+    workerThread.start();
+
+    // Las gráficas finales se actualizan en vivo durante la corrida
+    liveParetoPlot = new LiveScatterPlot("Frente de Pareto - Makespan vs Energía", 10.0);
+    livePopulationPlot = new LiveScatterPlot("Población Total - Makespan vs Energía", 8.0);
+    livePopulationPlot->setDensityThreshold(kDensityPointThreshold);
+
+    QVBoxLayout* paretoLayout = new QVBoxLayout(ui->plotParetoFinalWidget);
+    paretoLayout->setContentsMargins(0, 0, 0, 0);
+    paretoLayout->addWidget(liveParetoPlot);
+
+    QVBoxLayout* populationLayout = new QVBoxLayout(ui->plotPopulationFinalWidget);
+    populationLayout->setContentsMargins(0, 0, 0, 0);
+    populationLayout->addWidget(livePopulationPlot);
+
+    hypervolumeModel = new HypervolumeTableModel(this);
+    deferredViews = new DeferredRenderer(this);
 }
 
 void MainWindow::on_startButton_clicked()
 {
+    if (running) {
+        // Detener conserva lo obtenido: la corrida termina con la última generación completa
+        runner->requestStop();
+        ui->startButton->setEnabled(false);
+        ui->pauseButton->setEnabled(false);
+        return;
+    }
+
     ui->progressBar->setValue(0);
+    deferredViews->cancelAll();             // Lo que no se abrió de la corrida anterior ya no aplica
     clearWidget(ui->tablesWidget);
     clearWidget(ui->hyperWidget);
+    hypervolumeView = nullptr;
     QRandomGenerator rng;
 
     if (path.isEmpty()) {
@@ -126,16 +114,34 @@ void MainWindow::on_startButton_clicked()
     }
 
     scenario = loadScenario(path, policyNames);
-    QFile file(path);
 
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        qDebug() << "No se pudo abrir el archivo:" << path;
-        return;
+    // Consejero de hiperparámetros: servicio en config.ini, rangos y temperatura de la interfaz
+    AdvisorSettings advisor = loadAdvisorSettings("config.ini");
+    const QString uiKey = ui->inputKey->toPlainText().trimmed();
+    if (!uiKey.isEmpty()) {
+        advisor.apiKey = uiKey;
     }
+    advisor.temperature = ui->inputTemp->value();
+    advisor.minMutation = ui->inputMinMut->value();
+    advisor.maxMutation = ui->inputMaxMut->value();
+    advisor.minCrossover = ui->inputMinCross->value();
+    advisor.maxCrossover = ui->inputMaxCross->value();
+
+    // El prompt lleva un resumen de tamaño fijo salvo que se pida el archivo completo
+    advisor.fullScenarioPrompt = ui->checkFullScenarioPrompt->isChecked();
+    QString scenarioText;
+    if (advisor.fullScenarioPrompt) {
+        QFile file(path);
+
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            qDebug() << "No se pudo abrir el archivo:" << path;
+            return;
+        }
 
-    QTextStream in(&file);
-    QString contentScenario = in.readAll();  // Lee todo el contenido
-    file.close();
+        QTextStream in(&file);
+        scenarioText = in.readAll();  // Lee todo el contenido
+        file.close();
+    }
 
     int populationSize = ui->popSizeInput->value();
     qDebug() << "Tamaño de la Poblacion:" << populationSize;
@@ -154,11 +160,18 @@ void MainWindow::on_startButton_clicked()
 
     int numGenLLM = ui->inputNumGenLLM->value();
 
-    if (numGen == 0) {
+    RunBudget budget;
+    budget.maxGenerations = numGen;
+    budget.maxSeconds = ui->inputMaxSeconds->value();
+    budget.maxEvaluations = ui->inputMaxEvaluations->value();
+    budget.stagnationGenerations = ui->inputStagnation->value();
+
+    if (budget.maxGenerations == 0 && budget.maxSeconds <= 0.0
+        && budget.maxEvaluations == 0 && budget.stagnationGenerations == 0) {
         QMessageBox::critical(
             this,
             "Valor inválido",
-            "El número de generaciones debe ser mayor que 0."
+            "Debe indicar al menos un límite: generaciones, tiempo, evaluaciones o estancamiento."
             );
         return;
     }
@@ -170,81 +183,213 @@ void MainWindow::on_startButton_clicked()
     mutationRates[ReciprocalExchange]   = ui->inputInitialMutRE->value();
     mutationRates[Shift]                = ui->inputInitialMutShift->value();
 
-    EvolutionaryAlgorithm ea(
-        scenario,
-        policyNames,
-        populationSize,
-        crossoverRate,
-        mutationRates
-        );
+    RunSettings settings;
+    settings.scenario = std::make_shared<const ScenarioData>(scenario);
+    settings.policyNames = policyNames;
+    settings.populationSize = populationSize;
+    settings.budget = budget;
+    settings.checkpointInterval = numGenLLM;
+    settings.crossoverRate = crossoverRate;
+    settings.mutationRates = mutationRates;
+    settings.seed = static_cast<std::uint64_t>(ui->inputSeed->value());
+    settings.advisor = advisor;
+    settings.scenarioText = scenarioText;
+
+    // Adaptación local en cada generación, con los mismos rangos que el consejero
+    settings.rateControl.enabled = ui->checkAdaptiveRates->isChecked();
+    settings.rateControl.minMutation = advisor.minMutation;
+    settings.rateControl.maxMutation = advisor.maxMutation;
+    settings.rateControl.minCrossover = advisor.minCrossover;
+    settings.rateControl.maxCrossover = advisor.maxCrossover;
+
+    // Lo exportable es siempre de la última corrida terminada
+    csvInd.clear();
+
+    // El mismo botón detiene la corrida mientras está en curso
+    running = true;
+    ui->startButton->setText("Detener");
+    ui->pauseButton->setText("Pausar");
+    ui->pauseButton->setEnabled(true);
+    liveParetoPlot->setSeriesNames(policyNames);
+    livePopulationPlot->setSeriesNames(policyNames);
+    QMetaObject::invokeMethod(runner, [this, settings]() { runner->start(settings); },
+                              Qt::QueuedConnection);
+}
 
-    ea.initialize();
+void MainWindow::onRunStarted(quint64 seed,
+                              const QVector<Individual>& population,
+                              const QVector<HypervolumeStats>& hypervolumeStats)
+{
+    // La semilla efectiva se muestra para poder repetir la ejecución
+    ui->inputSeed->setToolTip(QString("Última semilla usada: %1").arg(seed));
+    qDebug() << "Semilla usada:" << seed;
+
+    // La población se comparte implícitamente: no se copia hasta que alguien la cambie
+    deferredViews->defer(ui->plotParetoFirstWidget, [this, population]() {
+        ChartPlotter::plotPareto(population, ui->plotParetoFirstWidget);
+    });
+    deferredViews->defer(ui->plotPopulationFirstWidget, [this, population]() {
+        ChartPlotter::plotPopulation(population, ui->plotPopulationFirstWidget);
+    });
+    addHypervolumeTable(hypervolumeStats, 0, policyNames);
+}
 
-    QVector<Individual> pop = ea.getPopulation();
-    QVector<QVector<double>> hypervolumes = ea.getHypervolumes();
-    QVector<QVector<double>> parameters;
+void MainWindow::onGenerationFinished(const GenerationSnapshot& snapshot)
+{
+    ui->progressBar->setValue(static_cast<int>(snapshot.budgetFraction * 100));
+    updateStatsPanel(snapshot.stats);
 
-    QString last20Str = hypervolumeStringLast20(hypervolumes, policyNames);
-    Individual kneePoint = ea.getKneePoint();
-    Individual bestMakespan = ea.getBestMakespan();
-    Individual bestEnergy = ea.getBestEnergy();
+    // Solo se guardan los datos; cada gráfica redibuja a lo sumo 10 veces por segundo
+    liveParetoPlot->setPoints(snapshot.front);
+    livePopulationPlot->setPoints(snapshot.objectives, snapshot.front);
+}
 
-    QString prompt;
+void MainWindow::onCheckpointReached(const CheckpointData& checkpoint)
+{
+    // La consulta al consejero la hace el runner; aquí solo se registra el punto
+    addHypervolumeTable(checkpoint.hypervolumeStats, checkpoint.generation, policyNames);
+}
 
-    ChartPlotter::plotPareto(pop, ui->plotParetoFirstWidget);
-    ChartPlotter::plotPopulation(pop, ui->plotPopulationFirstWidget);
-    addHypervolumeTable(hypervolumes, 0, policyNames);
+void MainWindow::onAdviceApplied(const AdviceEvent& event)
+{
+    qDebug() << "Consejo de la generación" << event.requestedGeneration
+             << "aplicado desde la generación" << event.appliedGeneration
+             << "latencia (ms):" << event.latencyMs;
 
-    for(int gen=1; gen<=numGen; gen++){
-        parameters.append({mutationRates[InterChromosome], mutationRates[ReciprocalExchange], mutationRates[Shift], crossoverRate});
-        ea.runGeneration();
-        ui->progressBar->setValue(gen*numGen/100);
-        if (gen % numGenLLM == 0 && gen!=numGen) {
-            hypervolumes = ea.getHypervolumes();
-            QVector<float> prevMutationRates(MutationCount);
-            prevMutationRates[InterChromosome]      = mutationRates[InterChromosome];
-            prevMutationRates[ReciprocalExchange]   = mutationRates[ReciprocalExchange];
-            prevMutationRates[Shift]                = mutationRates[Shift];
-            float prevCrossoverRate = crossoverRate;
+    addHyperparameterTable(event.appliedGeneration,
+                           event.previousCrossoverRate, event.previousMutationRates,
+                           event.crossoverRate, event.mutationRates);
+}
 
-            addHypervolumeTable(hypervolumes, gen, policyNames);
+void MainWindow::onRunFinished(const RunResult& result)
+{
+    running = false;
+    resetRunButtons();
+    qDebug() << "Corrida terminada:" << stopReasonText(result.stopReason)
+             << "generaciones:" << result.generations
+             << "evaluaciones:" << result.evaluations
+             << "segundos:" << result.elapsedSeconds;
 
-            last20Str = hypervolumeStringLast20(hypervolumes, policyNames);
-            kneePoint = ea.getKneePoint();
-            bestMakespan = ea.getBestMakespan();
-            bestEnergy = ea.getBestEnergy();
-            prompt = buildGeneticPrompt(contentScenario, last20Str, kneePoint, bestMakespan, bestEnergy, mutationRates, crossoverRate);
+    ui->progressBar->setValue(100);
+    addHypervolumeTable(result.hypervolumeStats, result.generations, policyNames);
+    // La última generación ya está en las gráficas en vivo: solo falta el cuadro pendiente
+    liveParetoPlot->flush();
+    livePopulationPlot->flush();
+    updateStatsPanel(result.stats);
+
+    // El CSV no depende de ninguna pestaña: exportar funciona sin abrir el resumen
+    csvInd = buildResultsCsv(result.bestMakespan, result.bestEnergy, result.kneePoint);
+
+    // El resto se construye al abrir cada pestaña, con lo mínimo de la corrida:
+    // historiales (compartidos implícitamente), tres individuos y la caché
+    const QVector<QString> names = policyNames;
+    const QVector<QVector<double>> hypervolumes = result.hypervolumes;
+    const QVector<QVector<double>> parameters = result.parameters;
+    const std::shared_ptr<ScheduleCache> schedules = result.schedules;
+    const SolverStats stats = result.stats;
+
+    QVector<int> adviceGenerations;
+    for (const AdviceEvent& event : result.adviceEvents) {
+        adviceGenerations.append(event.appliedGeneration);
+    }
 
-            qDebug() << "Prompt:" << prompt;
+    deferredViews->defer(ui->tablesWidget, [this, hypervolumes, names]() {
+        ChartPlotter::plotHypervolumeEvolution(hypervolumes, names, ui->tablesWidget);
+    });
+    deferredViews->defer(ui->hyperWidget, [this, parameters, adviceGenerations]() {
+        ChartPlotter::plotParameterEvolution(parameters, ui->hyperWidget, adviceGenerations);
+    });
+
+    // Las programaciones ya vienen decodificadas del hilo de trabajo; los aciertos
+    // de la caché se suman al panel conforme se abren los Gantt
+    auto deferGantt = [this, schedules, stats](const Individual& individual, QWidget* container) {
+        deferredViews->defer(container, [this, schedules, stats, individual, container]() {
+            ChartPlotter::plotGanttChart(individual, container, *schedules);
+
+            SolverStats withCache = stats;
+            withCache.cacheHits = schedules->getHits();
+            withCache.cacheLookups = schedules->getHits() + schedules->getMisses();
+            updateStatsPanel(withCache);
+        });
+    };
+    deferGantt(result.bestMakespan, ui->ganttMakespan);
+    deferGantt(result.kneePoint, ui->ganttKneePoint);
+    deferGantt(result.bestEnergy, ui->ganttEnergy);
+
+    const Individual bestMakespan = result.bestMakespan;
+    const Individual bestEnergy = result.bestEnergy;
+    const Individual kneePoint = result.kneePoint;
+    deferredViews->defer(ui->resultsWidget, [this, bestMakespan, bestEnergy, kneePoint]() {
+        showBestIndividualsSummary(bestMakespan, bestEnergy, kneePoint, ui->resultsWidget);
+    });
+}
 
-            QString response = callGeminiAPI(prompt, apiKey, ui->inputTemp->value());
+void MainWindow::onRunCancelled()
+{
+    running = false;
+    resetRunButtons();
+    qDebug() << "Corrida cancelada";
+}
 
-            qDebug() << "Respuesta del modelo:" << response;
-            parseHyperparametersFromString(response, mutationRates, crossoverRate);
+void MainWindow::on_pauseButton_clicked()
+{
+    if (!running) {
+        return;
+    }
 
-            addHyperparameterTable(gen,prevCrossoverRate,prevMutationRates,crossoverRate,mutationRates);
-        }
+    // Directo, no encolado: el hilo de trabajo puede estar bloqueado en la pausa
+    if (runner->isPaused()) {
+        runner->resume();
+        ui->pauseButton->setText("Pausar");
+    } else {
+        runner->pause();
+        ui->pauseButton->setText("Reanudar");
     }
+}
 
-    pop = ea.getPopulation();
-    hypervolumes = ea.getHypervolumes();
+void MainWindow::resetRunButtons()
+{
+    ui->startButton->setText("Iniciar Generación");
+    ui->startButton->setEnabled(true);
+    ui->pauseButton->setText("Pausar");
+    ui->pauseButton->setEnabled(false);
+}
 
-    ui->progressBar->setValue(100);
-    addHypervolumeTable(hypervolumes, numGen, policyNames);
-    ChartPlotter::plotHypervolumeEvolution(hypervolumes, policyNames, ui->tablesWidget);
-    ChartPlotter::plotParameterEvolution(parameters, ui->hyperWidget);
-    ChartPlotter::plotPareto(pop, ui->plotParetoFinalWidget);
-    ChartPlotter::plotPopulation(pop, ui->plotPopulationFinalWidget);
+void MainWindow::updateStatsPanel(const SolverStats& stats)
+{
+    ui->labelEvalRate->setText(QString("Evaluaciones/s: %1").arg(stats.evaluationsPerSecond, 0, 'f', 1));
+    ui->labelGenRate->setText(QString("Generaciones/s: %1").arg(stats.generationsPerSecond, 0, 'f', 2));
 
-    kneePoint = ea.getKneePoint();
-    bestMakespan = ea.getBestMakespan();
-    bestEnergy = ea.getBestEnergy();
+    if (stats.etaSeconds >= 0.0) {
+        ui->labelEta->setText(QString("Tiempo restante: %1 s").arg(stats.etaSeconds, 0, 'f', 1));
+    } else {
+        ui->labelEta->setText("Tiempo restante: —");
+    }
 
-    ChartPlotter::plotGanttChart(scenario, bestMakespan, ui->ganttMakespan, ea);
-    ChartPlotter::plotGanttChart(scenario, kneePoint, ui->ganttKneePoint, ea);
-    ChartPlotter::plotGanttChart(scenario, bestEnergy, ui->ganttEnergy, ea);
+    if (stats.cacheLookups > 0) {
+        ui->labelCacheRate->setText(QString("Aciertos de caché: %1 %").arg(stats.cacheHitRate() * 100, 0, 'f', 1));
+    } else {
+        ui->labelCacheRate->setText("Aciertos de caché: —");
+    }
 
-    showBestIndividualsSummary(bestMakespan, bestEnergy, kneePoint,ui->resultsWidget);
+    QStringList phases;
+    for (int p = 0; p < PhaseCount; ++p) {
+        phases << QString("%1 %2").arg(solverPhaseName(p)).arg(stats.phaseMs[p], 0, 'f', 1);
+    }
+    ui->labelPhaseTimes->setText("Fases (ms/gen): " + phases.join(", "));
+}
+
+QString MainWindow::stopReasonText(StopReason reason)
+{
+    switch (reason) {
+    case StopReason::Generations: return "límite de generaciones";
+    case StopReason::Evaluations: return "límite de evaluaciones";
+    case StopReason::Time:        return "límite de tiempo";
+    case StopReason::Stagnation:  return "hipervolumen estancado";
+    case StopReason::Cancelled:   return "detenida por el usuario";
+    case StopReason::None:        break;
+    }
+    return "en curso";
 }
 
 void MainWindow::on_fileButton_clicked()
@@ -325,165 +470,46 @@ QString MainWindow::openTxtFile(QWidget *parent)
     return filePath;
 }
 
-QString MainWindow::buildGeneticPrompt(
-    const QString& contentScenario,
-    const QString& last10Hypervolumes,
-    const Individual& kneePoint,
-    const Individual& bestMakespan,
-    const Individual& bestEnergy,
-    const QVector<float>& mutationRates,
-    float crossoverRate)
-{
-    // ============================
-    // Construir el prompt
-    // ============================
-    QString prompt = QString(R"(Eres un asistente experto en optimización de algoritmos genéticos para planificación de tareas.
-    Tu tarea es sugerir los hiperparámetros de un algoritmo genético basado en los resultados de cada generación en un escenario de máquinas y operaciones.
-
-    El escenario es el siguiente:
-
-    %1
-
-    A continuación, te proporcionaré los resultados de la evolución del algoritmo genético y los anteriores hiperparámetros:
-
-    - Lista de hipervolúmenes por generación: %2
-    - Punto de rodilla: %3
-    - Mejor makespan: %4
-    - Mejor energía: %5
-    - MutationRate InterChromosome: %6
-    - MutationRate ReciprocalExchange: %7
-    - MutationRate Shift: %8
-    - CrossoverRate: %9
-
-    Con base en estos resultados, sugiere los valores óptimos de los hiperparámetros para la siguiente ejecución del algoritmo genético:
-
-    - MutationRate para InterChromosome, ReciprocalExchange, Shift
-    - CrossoverRate
-
-    Devuelve únicamente una lista con 4 valores, en el siguiente orden y formato:
-
-    [InterChromosome, ReciprocalExchange, Shift, crossoverRate]
-
-    Las mutaciones puede ir de %10 a %11 y el crossoverRate puede ir de %12 a %13
-
-    No agregues explicaciones ni texto adicional. Solo devuelve la lista con los valores sugeridos.)")
-                         .arg(contentScenario)
-                         .arg(last10Hypervolumes)
-                         .arg(kneePoint.toString(true))
-                         .arg(bestMakespan.toString(true))
-                         .arg(bestEnergy.toString(true))
-                         .arg(mutationRates[InterChromosome])
-                         .arg(mutationRates[ReciprocalExchange])
-                         .arg(mutationRates[Shift])
-                         .arg(crossoverRate)
-                         .arg(ui->inputMinMut->value())
-                         .arg(ui->inputMaxMut->value())
-                         .arg(ui->inputMinCross->value())
-                         .arg(ui->inputMaxCross->value());
-
-    return prompt;
-}
-
 void MainWindow::addHypervolumeTable(
-    const QVector<QVector<double>>& hypervolumes,
+    const QVector<HypervolumeStats>& hypervolumeStats,
     int generation,
     const QVector<QString>& policyNames)
 {
-    if (hypervolumes.isEmpty())
+    if (hypervolumeStats.isEmpty())
         return;
 
-    int numPolicies = policyNames.size();
-
-    // =============================
-    // TITULO DE LA GENERACION
-    // =============================
-    QLabel* title = new QLabel(
-        QString("Generación %1").arg(generation));
-    title->setStyleSheet("font-weight: bold; font-size: 14px;");
-    title->setAlignment(Qt::AlignCenter);
-
-    // =============================
-    // TABLA
-    // =============================
-    QTableWidget* table = new QTableWidget(numPolicies, 4);
-    table->setHorizontalHeaderLabels(
-        {"Política", "Min", "Max", "Promedio"});
-
     // =============================
-    // CALCULO POR POLITICA
+    // VISTA ÚNICA (se crea en el primer punto de la corrida)
     // =============================
-    for (int c = 0; c < numPolicies; ++c) {
+    if (!hypervolumeView) {
+        hypervolumeModel->clear();
 
-        QVector<double> hvPerPolicy;
+        QLabel* title = new QLabel("Hipervolumen por generación");
+        title->setStyleSheet("font-weight: bold; font-size: 14px;");
+        title->setAlignment(Qt::AlignCenter);
 
-        // recorrer generaciones hasta la actual
-        for (int g = 0; g < hypervolumes.size(); ++g) {
-            if (c < hypervolumes[g].size())
-                hvPerPolicy.append(hypervolumes[g][c]);
+        hypervolumeView = new QTableView();
+        hypervolumeView->setModel(hypervolumeModel);
+        hypervolumeView->verticalHeader()->setVisible(false);
+        // Alto fijo: la vista no mide filas que no están en pantalla
+        hypervolumeView->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+        hypervolumeView->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+        hypervolumeView->setEditTriggers(QAbstractItemView::NoEditTriggers);
+        hypervolumeView->setAlternatingRowColors(true);
+        hypervolumeView->setMinimumHeight(300);
+
+        if (!ui->tablesWidget->layout()) {
+            ui->tablesWidget->setLayout(new QVBoxLayout());
         }
-
-        if (hvPerPolicy.isEmpty())
-            continue;
-
-        double minVal = *std::min_element(hvPerPolicy.begin(), hvPerPolicy.end());
-        double maxVal = *std::max_element(hvPerPolicy.begin(), hvPerPolicy.end());
-        double mean   = std::accumulate(
-                          hvPerPolicy.begin(),
-                          hvPerPolicy.end(), 0.0)
-                      / hvPerPolicy.size();
-
-        table->setItem(c, 0, new QTableWidgetItem(policyNames[c]));
-        table->setItem(c, 1, new QTableWidgetItem(QString::number(minVal, 'f', 4)));
-        table->setItem(c, 2, new QTableWidgetItem(QString::number(maxVal, 'f', 4)));
-        table->setItem(c, 3, new QTableWidgetItem(QString::number(mean, 'f', 4)));
+        ui->tablesWidget->layout()->addWidget(title);
+        ui->tablesWidget->layout()->addWidget(hypervolumeView);
     }
 
-    table->resizeColumnsToContents();
-    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
-    table->setMinimumHeight(25+30*numPolicies);
-
     // =============================
-    // AGREGAR AL LAYOUT
+    // NUEVAS FILAS (O(políticas))
     // =============================
-    if (!ui->tablesWidget->layout()) {
-        ui->tablesWidget->setLayout(new QVBoxLayout());
-    }
-
-    ui->tablesWidget->layout()->addWidget(title);
-    ui->tablesWidget->layout()->addWidget(table);
-}
-
-QString MainWindow::hypervolumeStringLast20(
-    const QVector<QVector<double>>& hypervolumes,
-    const QVector<QString>& policyNames)
-{
-    if (hypervolumes.isEmpty() || policyNames.isEmpty())
-        return QString();
-
-    int numPolicies = policyNames.size();
-    QString result;
-
-    // Recorrer cada política
-    for (int c = 0; c < numPolicies; ++c) {
-        QVector<double> last20;
-
-        // Tomar hasta los últimos 20 de la política c
-        for (int g = qMax<qsizetype>(0, hypervolumes.size() - 20); g < hypervolumes.size(); ++g) {
-            if (c < hypervolumes[g].size())
-                last20.append(hypervolumes[g][c]);
-        }
-
-        // Convertir QVector<double> a QString separado por comas
-        QStringList strList;
-        for (double val : last20)
-            strList << QString::number(val, 'f', 4);
-
-        result += QString("%1: [%2]\n")
-                      .arg(policyNames[c])
-                      .arg(strList.join(", "));
-    }
-
-    return result;
+    hypervolumeModel->appendCheckpoint(generation, policyNames, hypervolumeStats);
+    hypervolumeView->scrollToBottom();
 }
 
 void MainWindow::addHyperparameterTable(
@@ -626,8 +652,14 @@ void MainWindow::showBestIndividualsSummary(
     addIndividualTable(kneePoint,    "Punto de Rodilla");
 
     widget->setLayout(mainLayout);
+}
 
-    QTextStream out(&csvInd);
+QString MainWindow::buildResultsCsv(const Individual &bestMakespan,
+                                    const Individual &bestEnergy,
+                                    const Individual &kneePoint)
+{
+    QString csv;
+    QTextStream out(&csv);
 
     // Header
     out << "IndividualType,Policy,Genes,Makespan,Energia\n";
@@ -653,77 +685,18 @@ void MainWindow::showBestIndividualsSummary(
     appendIndividual(bestMakespan, "BestMakespan");
     appendIndividual(bestEnergy,   "BestEnergy");
     appendIndividual(kneePoint,    "KneePoint");
-}
-
-QString MainWindow::callGeminiAPI(const QString &prompt,
-                                  const QString &apiKey,
-                                  double temperature)
-{
-    QNetworkAccessManager manager;
-
-    QUrl url("https://generativelanguage.googleapis.com/v1beta/models/gemini-2.5-flash:generateContent");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-    request.setRawHeader("x-goog-api-key", apiKey.toUtf8());
-
-    // Construir JSON
-    QJsonObject partObj;
-    partObj["text"] = prompt;
 
-    QJsonArray partsArray;
-    partsArray.append(partObj);
-
-    QJsonObject contentObj;
-    contentObj["parts"] = partsArray;
-
-    QJsonArray contentsArray;
-    contentsArray.append(contentObj);
-
-    QJsonObject generationConfig;
-    generationConfig["temperature"] = temperature;
-
-    QJsonObject rootObj;
-    rootObj["contents"] = contentsArray;
-    rootObj["generationConfig"] = generationConfig;
-
-    QJsonDocument doc(rootObj);
-    QByteArray data = doc.toJson();
-
-    QNetworkReply* reply = manager.post(request, data);
-
-    // ⚡ Esperar a que termine la respuesta
-    QEventLoop loop;
-    connect(reply, &QNetworkReply::finished, &loop, &QEventLoop::quit);
-    loop.exec();  // bloquea aquí hasta que reply termine
-
-    QString generatedText;
-
-    if (reply->error() != QNetworkReply::NoError) {
-        qDebug() << "Error en request:" << reply->errorString();
-    } else {
-        QByteArray responseData = reply->readAll();
-
-        // Parse JSON
-        QJsonDocument jsonDoc = QJsonDocument::fromJson(responseData);
-        if (jsonDoc.isObject()) {
-            QJsonObject obj = jsonDoc.object();
-            QJsonArray candidates = obj["candidates"].toArray();
-            if (!candidates.isEmpty()) {
-                QJsonObject firstCandidate = candidates[0].toObject();
-                QJsonObject content = firstCandidate["content"].toObject();
-                QJsonArray parts = content["parts"].toArray();
-                if (!parts.isEmpty()) {
-                    generatedText = parts[0].toObject()["text"].toString();
-                }
-            }
-        }
-    }
-
-    reply->deleteLater();
-    return generatedText;  // retorna el texto directamente
+    out.flush();
+    return csv;
 }
 
+
 MainWindow::~MainWindow()
 {
+    // La generación en curso se abandona (también si está en pausa); el runner se
+    // destruye con deleteLater
+    runner->requestStop();
+    workerThread.quit();
+    workerThread.wait();
     delete ui;
 }
@@ -5,8 +5,14 @@
 #include "scenariodata.h"           // Estructura con los datos del problema de scheduling
 #include "scheduletypes.h"          // Tipos relacionados con el scheduling (OperationSchedule, etc.)
 #include "EvolutionaryAlgorithm.h"  // El núcleo del algoritmo evolutivo multiobjetivo
+#include "evolutionrunner.h"        // Ejecución del algoritmo en un hilo de trabajo
+#include "livescatterplot.h"        // Frente y población actualizados en vivo
+#include "hypervolumetablemodel.h"  // Historial de hipervolúmenes (una sola vista)
+#include "deferredrenderer.h"       // Vistas de resultados construidas al mostrarse
 
 #include <QMainWindow>              // Clase base de ventana principal en Qt
+#include <QThread>
+#include <QTableView>
 
 QT_BEGIN_NAMESPACE
 namespace Ui {
@@ -35,6 +41,7 @@ private slots:
      * (botón principal "Iniciar"/"Detener")
      */
     void on_startButton_clicked();
+    void on_pauseButton_clicked();
 
     /**
      * @brief Abre diálogo para seleccionar archivo de instancia del problema
@@ -54,25 +61,58 @@ private slots:
      */
     void onPolicyToggled(bool checked);
 
+    // Señales del hilo de trabajo (la interfaz solo dibuja)
+    void onRunStarted(quint64 seed,
+                      const QVector<Individual>& population,
+                      const QVector<HypervolumeStats>& hypervolumeStats);
+    void onGenerationFinished(const GenerationSnapshot& snapshot);
+    void onCheckpointReached(const CheckpointData& checkpoint);
+    void onAdviceApplied(const AdviceEvent& event);
+    void onRunFinished(const RunResult& result);
+    void onRunCancelled();
+
 private:
     Ui::MainWindow *ui;                 // Interfaz generada por Qt Designer
 
-    QString apiKey;                     // Clave para la API de Google Gemini
     QString path = "";                  // Ruta del archivo de instancia cargado actualmente
-    QString csvInd = "";                // (Posiblemente nombre o contenido para exportación CSV)
+    QString csvInd = "";                // CSV de los individuos destacados de la última corrida
 
     ScenarioData scenario;              // Datos del problema actualmente cargados
 
     QVector<QString> policyNames = {"FIFO"};  // Políticas activas (inicialmente solo FIFO)
                                               // Se pueden añadir más dinámicamente
 
+    // Corrida en curso: el motor vive en el hilo de trabajo, dentro de 'runner'
+    QThread workerThread;
+    EvolutionRunner* runner = nullptr;              // Pertenece a workerThread (deleteLater)
+    bool running = false;
+
+    // Gráficas persistentes de la corrida: se alimentan en cada generación
+    LiveScatterPlot* liveParetoPlot = nullptr;
+    LiveScatterPlot* livePopulationPlot = nullptr;
+
+    // Gráficas, Gantt y resumen de la última corrida: se construyen al abrir su pestaña
+    DeferredRenderer* deferredViews = nullptr;
+
+    HypervolumeTableModel* hypervolumeModel = nullptr;
+    QTableView* hypervolumeView = nullptr;          // Se recrea en tablesWidget en cada corrida
+
     // Métodos auxiliares para actualización de la interfaz
 
+    /** @brief Botones de inicio/pausa en su estado sin corrida */
+    void resetRunButtons();
+
+    /** @brief Actualiza el panel de rendimiento (tasas, fases, caché y ETA) */
+    void updateStatsPanel(const SolverStats& stats);
+
+    /** @brief Texto para registrar por qué terminó una corrida */
+    static QString stopReasonText(StopReason reason);
+
     /**
-     * @brief Añade/actualiza la tabla de evolución de hipervolúmenes
-     * en la interfaz (normalmente una QTableWidget)
+     * @brief Agrega al historial de hipervolúmenes una fila por política
+     * (estadísticas ya acumuladas por el motor: costo constante por llamada)
      */
-    void addHypervolumeTable(const QVector<QVector<double>>& hypervolumes,
+    void addHypervolumeTable(const QVector<HypervolumeStats>& hypervolumeStats,
                             int generation,
                             const QVector<QString>& policyNames);
 
@@ -98,41 +138,18 @@ private:
                                    QWidget *widget);
 
     /**
-     * @brief Abre un diálogo para seleccionar y leer un archivo de texto
-     * @return Contenido completo del archivo como QString
+     * @brief CSV con los cromosomas de los tres individuos destacados
+     * (lo que exporta on_exportCsvButton_clicked)
      */
-    QString openTxtFile(QWidget *parent);
-
-    /**
-     * @brief Genera un string con los últimos 20 valores de hipervolumen
-     * (formato legible para mostrar o enviar a la API)
-     */
-    QString hypervolumeStringLast20(const QVector<QVector<double>>& hypervolumes,
-                                   const QVector<QString>& policyNames);
-
-    /**
-     * @brief Construye el prompt completo que se enviará a Gemini
-     * Incluye descripción del problema, evolución reciente, mejores soluciones
-     * y parámetros actuales del algoritmo
-     */
-    QString buildGeneticPrompt(const QString& contentScenario,
-                              const QString& last10Hypervolumes,
-                              const Individual& kneePoint,
-                              const Individual& bestMakespan,
-                              const Individual& bestEnergy,
-                              const QVector<float>& mutationRates,
-                              float crossoverRate);
+    static QString buildResultsCsv(const Individual &bestMakespan,
+                                   const Individual &bestEnergy,
+                                   const Individual &kneePoint);
 
     /**
-     * @brief Realiza la llamada real a la API de Google Gemini
-     * @param prompt Texto completo del prompt
-     * @param apiKey Clave de autenticación
-     * @param temperature Nivel de creatividad (0.0 = determinista, 1.0 = más creativo)
-     * @return Respuesta generada por el modelo (normalmente sugerencias de parámetros)
+     * @brief Abre un diálogo para seleccionar y leer un archivo de texto
+     * @return Contenido completo del archivo como QString
      */
-    QString callGeminiAPI(const QString &prompt,
-                         const QString &apiKey,
-                         double temperature = 0.7);
+    QString openTxtFile(QWidget *parent);
 };
 
 #endif // MAINWINDOW_H
\ No newline at end of file
@@ -1,86 +1,149 @@
 #include "mutations.h"
 
 #include <algorithm>
-#include <numeric>
+#include <cmath>
+
+// =======================
+// MUESTREO
+// =======================
+void sampleWithoutReplacement(int n, int k, Rng& rng, int* out)
+{
+    // Floyd: para j = n-k .. n-1 se sortea t en [0, j]; si t ya salió, se toma j
+    int count = 0;
+    for (int j = n - k; j < n; j++) {
+        std::uniform_int_distribution<int> distT(0, j);
+        int t = distT(rng);
+
+        if (std::find(out, out + count, t) != out + count) {
+            t = j;
+        }
+        out[count++] = t;
+    }
+
+    // Floyd no produce un orden uniforme; se baraja solo el resultado (k elementos)
+    std::shuffle(out, out + count, rng);
+}
+
+void sampleBernoulliIndices(int n, double p, Rng& rng, QVector<int>& out)
+{
+    out.clear();
+    if (n <= 0 || !(p > 0.0)) {
+        return;
+    }
+
+    if (p >= 1.0) {
+        out.resize(n);
+        for (int i = 0; i < n; i++) out[i] = i;
+        return;
+    }
+
+    // Número de fracasos antes de cada éxito ~ Geométrica(p), por inversión:
+    // floor(log(U) / log(1 - p)). Se calcula en double y se acota a n, porque con
+    // p diminuta el salto no cabe en un entero (y std::geometric_distribution, que
+    // usa log(1 - p) == 0, rechazaría candidatos sin fin)
+    const double logQ = std::log1p(-p);
+    long long i = -1;
+    while (true) {
+        const double skip = std::floor(std::log(1.0 - rng.uniform01()) / logQ);   // 1 - U ∈ (0, 1]
+        i += 1 + static_cast<long long>(std::min(skip, static_cast<double>(n)));
+        if (i >= n) break;
+        out.append(static_cast<int>(i));
+    }
+}
 
 // =======================
 // INTER-CHROMOSOME
 // =======================
-void mutationInterChromosome(Individual& individual,
-                             std::mt19937& rng,
-                             float mutationRate,
-                             std::uniform_real_distribution<double>& dist)
+int kernelInterChromosome(Individual& individual,
+                          Rng& rng,
+                          QVector<GeneChange>* changes)
 {
-    if (dist(rng) < mutationRate) {
-        std::uniform_int_distribution<int> distInt(0, individual.getNumChromosomes() - 1);
+    if (individual.getNumChromosomes() < 2) {
+        return 0;                   // Con una sola política no hay con quién intercambiar
+    }
 
-        int a = distInt(rng);
-        int b;
-        do {
-            b = distInt(rng);
-        } while (b == a);
+    int ab[2];
+    sampleWithoutReplacement(individual.getNumChromosomes(), 2, rng, ab);
 
-        std::swap(individual.chromosomes[a].genes,
-                  individual.chromosomes[b].genes);
+    std::swap(individual.chromosomes[ab[0]].genes,
+              individual.chromosomes[ab[1]].genes);
+
+    if (changes) {
+        changes->append({ab[0], -1});
+        changes->append({ab[1], -1});
     }
+    return 2;
 }
 
 // =======================
 // RECIPROCAL EXCHANGE
 // =======================
-void mutationReciprocalExchange(Individual& individual,
-                                std::mt19937& rng,
-                                float mutationRate,
-                                std::uniform_real_distribution<double>& dist)
+int kernelReciprocalExchange(Individual& individual,
+                             Rng& rng,
+                             QVector<GeneChange>* changes)
 {
-    if (dist(rng) < mutationRate) {
-        std::uniform_int_distribution<int> distK(1, 3);
-        int n = individual.chromosomes[0].genes.size();
+    std::uniform_int_distribution<int> distK(1, 3);
+    int n = individual.chromosomes[0].genes.size();
+    int changed = 0;
+
+    for (int c = 0; c < individual.getNumChromosomes(); c++) {
+        int k = std::min(distK(rng), n / 2);
 
-        for (int c = 0; c < individual.getNumChromosomes(); c++) {
-            int k = distK(rng);
+        int positions[6];
+        sampleWithoutReplacement(n, 2 * k, rng, positions);
 
-            std::vector<int> indexes(n);
-            std::iota(indexes.begin(), indexes.end(), 0);
-            std::shuffle(indexes.begin(), indexes.end(), rng);
+        int* genes = individual.chromosomes[c].genes.data();
+        for (int pairCount = 0; pairCount < k; pairCount++) {
+            int i = positions[2 * pairCount];
+            int j = positions[2 * pairCount + 1];
 
-            for (int pairCount = 0; pairCount < k; pairCount++) {
-                int i = indexes[2 * pairCount];
-                int j = indexes[2 * pairCount + 1];
+            std::swap(genes[i], genes[j]);
 
-                std::swap(individual.chromosomes[c].genes[i],
-                          individual.chromosomes[c].genes[j]);
+            if (changes) {
+                changes->append({c, i});
+                changes->append({c, j});
             }
         }
+        changed += 2 * k;
     }
+
+    return changed;
 }
 
 // =======================
 // SHIFT MUTATION
 // =======================
-void mutationShift(Individual& individual,
-                   std::mt19937& rng,
-                   float mutationRate,
-                   std::uniform_real_distribution<double>& dist)
+int kernelShift(Individual& individual,
+                Rng& rng,
+                QVector<GeneChange>* changes)
 {
-    if (dist(rng) < mutationRate) {
-        std::uniform_int_distribution<int> distWindow(3, 5);
-        int windowSize = distWindow(rng);
+    std::uniform_int_distribution<int> distWindow(3, 5);
+    int n = individual.chromosomes[0].genes.size();
+    int windowSize = std::min(distWindow(rng), n);
 
-        int n = individual.chromosomes[0].genes.size();
+    if (windowSize < 2) {
+        return 0;
+    }
 
-        for (int c = 0; c < individual.getNumChromosomes(); c++) {
-            std::uniform_int_distribution<int> distStart(0, n - windowSize);
-            int startIdx = distStart(rng);
+    for (int c = 0; c < individual.getNumChromosomes(); c++) {
+        std::uniform_int_distribution<int> distStart(0, n - windowSize);
+        int startIdx = distStart(rng);
 
-            int last = individual.chromosomes[c].genes[startIdx + windowSize - 1];
+        int* genes = individual.chromosomes[c].genes.data();
+        int last = genes[startIdx + windowSize - 1];
 
-            for (int i = startIdx + windowSize - 1; i > startIdx; i--) {
-                individual.chromosomes[c].genes[i] =
-                    individual.chromosomes[c].genes[i - 1];
-            }
+        for (int i = startIdx + windowSize - 1; i > startIdx; i--) {
+            genes[i] = genes[i - 1];
+        }
 
-            individual.chromosomes[c].genes[startIdx] = last;
+        genes[startIdx] = last;
+
+        if (changes) {
+            for (int i = startIdx; i < startIdx + windowSize; i++) {
+                changes->append({c, i});
+            }
         }
     }
+
+    return windowSize * individual.getNumChromosomes();
 }
@@ -1,7 +1,9 @@
 #ifndef MUTATIONS_H
 #define MUTATIONS_H
 
-#include <random>                   // Para std::mt19937 y distribuciones aleatorias
+#include <random>                   // Distribuciones aleatorias
+#include "rng.h"                    // Generador xoshiro256++
+#include <QVector>
 #include "individual.h"             // Clase Individual (contiene múltiples cromosomas)
 
 /**
@@ -11,52 +13,92 @@
  * Todas las mutaciones operan directamente sobre un objeto Individual,
  * afectando uno o varios de sus cromosomas según el tipo de mutación.
  * 
- * Cada función recibe:
+ * Cada núcleo recibe:
  * - El individuo a mutar (por referencia)
- * - Generador de números aleatorios (Mersenne Twister)
- * - Tasa de mutación específica para ese operador
- * - Distribución uniforme [0,1) para decidir si aplicar la mutación
+ * - Generador de números aleatorios (xoshiro256++, ver Rng.h)
+ * - Lista opcional donde anotar las posiciones modificadas
+ *
+ * La decisión de aplicar o no cada operador (su tasa) se toma fuera, en lote
+ * (ver sampleBernoulliIndices y EvolutionaryAlgorithm::mutateRange).
  */
 
+// =======================
+// NÚCLEOS DE MUTACIÓN
+// =======================
+
+/**
+ * @brief Posición de un gen modificado por un operador de mutación
+ *
+ * position == -1 indica que cambió el cromosoma completo (por ejemplo, en la
+ * mutación inter-cromosoma se intercambian secuencias enteras).
+ */
+struct GeneChange {
+    int chromosome = -1;            // Índice del cromosoma dentro del individuo
+    int position = -1;              // Índice del gen (-1 = cromosoma completo)
+};
+
+/**
+ * @brief Firma común de los núcleos de mutación
+ *
+ * Un núcleo aplica SIEMPRE la mutación (la decisión probabilística se toma
+ * fuera, ver sampleBernoulliIndices) y devuelve cuántas posiciones modificó.
+ * Si 'changes' no es nulo, se le añaden las posiciones modificadas.
+ */
+using MutationKernel = int (*)(Individual& individual,
+                               Rng& rng,
+                               QVector<GeneChange>* changes);
+
 /**
  * @brief Mutación entre cromosomas (Inter-Chromosome)
- * 
+ *
  * Intercambia material genético (genes) entre diferentes cromosomas del mismo individuo.
  * Representa una transferencia de conocimiento o estrategia entre políticas distintas.
- * 
+ *
  * Típicamente útil cuando se quiere fomentar cooperación o intercambio de buenas ideas
  * entre diferentes codificaciones/heurísticas.
  */
-void mutationInterChromosome(Individual& individual,
-                            std::mt19937& rng,
-                            float mutationRate,
-                            std::uniform_real_distribution<double>& dist);
+int kernelInterChromosome(Individual& individual, Rng& rng, QVector<GeneChange>* changes);
 
 /**
  * @brief Mutación por intercambio recíproco (Reciprocal Exchange)
- * 
+ *
  * Dentro de un mismo cromosoma, selecciona dos posiciones y las intercambia.
  * Clásica mutación de intercambio usada en problemas de permutación o secuencias.
- * 
+ *
  * Muy común en problemas de scheduling donde el orden importa (job shop, flow shop, etc.).
  */
-void mutationReciprocalExchange(Individual& individual,
-                               std::mt19937& rng,
-                               float mutationRate,
-                               std::uniform_real_distribution<double>& dist);
+int kernelReciprocalExchange(Individual& individual, Rng& rng, QVector<GeneChange>* changes);
 
 /**
  * @brief Mutación por desplazamiento (Shift)
- * 
+ *
  * Selecciona un gen y lo desplaza hacia otra posición dentro del mismo cromosoma,
  * desplazando los genes intermedios para mantener la longitud.
- * 
+ *
  * Similar a una inserción/eliminación en una posición, útil para alterar ligeramente
  * secuencias manteniendo la mayoría de la estructura original.
  */
-void mutationShift(Individual& individual,
-                  std::mt19937& rng,
-                  float mutationRate,
-                  std::uniform_real_distribution<double>& dist);
+int kernelShift(Individual& individual, Rng& rng, QVector<GeneChange>* changes);
+
+/**
+ * @brief Muestreo de k posiciones distintas en [0, n) (algoritmo de Floyd)
+ *
+ * Realiza exactamente k sorteos, sin construir ni barajar un vector de n índices.
+ * Pensado para k pequeño (la comprobación de duplicados es lineal en k).
+ * El orden de salida es aleatorio.
+ *
+ * @param out Buffer de salida con espacio para k enteros
+ */
+void sampleWithoutReplacement(int n, int k, Rng& rng, int* out);
+
+/**
+ * @brief Decisiones de Bernoulli en lote: índices i en [0, n) con éxito de probabilidad p
+ *
+ * Usa saltos geométricos entre éxitos, por lo que el costo es proporcional al
+ * número de éxitos (≈ n·p) y no a n.
+ *
+ * @param out Se vacía y recibe los índices seleccionados en orden creciente
+ */
+void sampleBernoulliIndices(int n, double p, Rng& rng, QVector<int>& out);
 
 #endif // MUTATIONS_H
\ No newline at end of file
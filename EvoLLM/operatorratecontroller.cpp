@@ -0,0 +1,108 @@
+#include "operatorratecontroller.h"
+
+#include <algorithm>
+
+namespace {
+
+const int kMutationArms = ArmCrossover;     // Brazos [0, ArmCrossover) = tipos de mutación
+
+float clampRate(double value, float low, float high) {
+    return static_cast<float>(std::min<double>(std::max<double>(value, low), high));
+}
+
+} // namespace
+
+OperatorRateController::OperatorRateController(const OperatorRateSettings& settings)
+    : config(settings) {
+    config.window = std::max(1, config.window);
+    config.minProbability = std::clamp(config.minProbability, 0.0, 1.0 / kMutationArms);
+}
+
+// ================= Estado =================
+
+void OperatorRateController::reset(const QVector<float>& mutationRates, float crossoverRate) {
+    history.clear();
+    next = 0;
+    total = OperatorCredit();
+    rebase(mutationRates, crossoverRate);
+}
+
+void OperatorRateController::rebase(const QVector<float>& mutationRates, float crossoverRate) {
+    rates = mutationRates;
+
+    // Con tasa 1 (o 0) uno de los dos brazos nunca se aplica y la cruza no puede
+    // adaptarse: se parte del mismo piso pmin que usa update()
+    const double pmin = config.minProbability;
+    crossover = clampRate(std::clamp<double>(crossoverRate, pmin, 1.0 - pmin),
+                          config.minCrossover, config.maxCrossover);
+
+    mutationBudget = 0.0f;
+    for (float rate : rates) {
+        mutationBudget += rate;
+    }
+}
+
+std::array<double, OperatorArmCount> OperatorRateController::quality() const {
+    std::array<double, OperatorArmCount> q;
+    for (int arm = 0; arm < OperatorArmCount; ++arm) {
+        q[arm] = total.applications[arm] > 0 ? total.reward[arm] / total.applications[arm] : -1.0;
+    }
+    return q;
+}
+
+// ================= Actualización =================
+
+void OperatorRateController::update(const OperatorCredit& credit) {
+    // Ventana deslizante: lo que sale del anillo se resta de la suma
+    if (history.size() < config.window) {
+        history.append(credit);
+    } else {
+        const OperatorCredit& oldest = history[next];
+        for (int arm = 0; arm < OperatorArmCount; ++arm) {
+            total.applications[arm] -= oldest.applications[arm];
+            total.reward[arm] -= oldest.reward[arm];
+        }
+        history[next] = credit;
+        next = (next + 1) % config.window;
+    }
+    for (int arm = 0; arm < OperatorArmCount; ++arm) {
+        total.applications[arm] += credit.applications[arm];
+        total.reward[arm] += credit.reward[arm];
+    }
+
+    const std::array<double, OperatorArmCount> q = quality();
+    const double pmin = config.minProbability;
+
+    // Mutación: un brazo sin aplicaciones en la ventana conserva su parte actual
+    if (mutationBudget > 0.0f && rates.size() == kMutationArms) {
+        double known = 0.0;
+        double knownShare = 0.0;
+        for (int arm = 0; arm < kMutationArms; ++arm) {
+            if (q[arm] >= 0.0) {
+                known += q[arm];
+                knownShare += rates[arm] / mutationBudget;
+            }
+        }
+
+        if (known > 0.0) {
+            QVector<double> share(kMutationArms);
+            for (int arm = 0; arm < kMutationArms; ++arm) {
+                const double current = rates[arm] / mutationBudget;
+                share[arm] = q[arm] >= 0.0 ? knownShare * q[arm] / known : current;
+            }
+            for (int arm = 0; arm < kMutationArms; ++arm) {
+                const double p = pmin + (1.0 - kMutationArms * pmin) * share[arm];
+                rates[arm] = clampRate(mutationBudget * p, config.minMutation, config.maxMutation);
+            }
+        }
+    }
+
+    // Cruza contra copia (hace falta haber visto los dos brazos)
+    if (q[ArmCrossover] >= 0.0 && q[ArmCopy] >= 0.0) {
+        const double sum = q[ArmCrossover] + q[ArmCopy];
+        if (sum > 0.0) {
+            const double p = pmin + (1.0 - 2.0 * pmin) * q[ArmCrossover] / sum;
+            crossover = clampRate(p, config.minCrossover, config.maxCrossover);
+        }
+    }
+}
@@ -0,0 +1,111 @@
+#ifndef OPERATOR_RATE_CONTROLLER_H
+#define OPERATOR_RATE_CONTROLLER_H
+
+#include <QVector>
+#include <array>
+
+/**
+ * @file OperatorRateController.h
+ * @brief Adaptación de las tasas de mutación y cruza por asignación de crédito
+ * (probability matching sobre una ventana deslizante de generaciones)
+ */
+
+/**
+ * @brief Brazos del bandido: cada forma en que un operador pudo producir unos genes
+ *
+ * Los tres primeros coinciden con MutationType; Crossover y Copy son las dos
+ * salidas de la decisión de cruza de cada pareja.
+ */
+enum OperatorArm {
+    ArmInterChromosome = 0,
+    ArmReciprocalExchange,
+    ArmShift,
+    ArmCrossover,                           // Hijo de una cruza uniforme
+    ArmCopy,                                // Hijo copiado del padre (sin cruza)
+    OperatorArmCount
+};
+
+/** @brief Bit de un brazo en Chromosome::operators */
+inline constexpr unsigned operatorBit(int arm) { return 1u << arm; }
+
+/**
+ * @brief Crédito de una generación por brazo
+ *
+ * applications cuenta cuántas veces se aplicó cada operador (a cualquier
+ * cromosoma, sobreviva o no); reward suma, sobre los cromosomas de la nueva
+ * población que ese operador tocó en esta generación, 1 / rango de Pareto
+ * (1 en el primer frente). Así un operador cuyos resultados no sobreviven
+ * o quedan en frentes lejanos acumula poco crédito por aplicación.
+ */
+struct OperatorCredit {
+    std::array<long long, OperatorArmCount> applications{};
+    std::array<double, OperatorArmCount> reward{};
+};
+
+/**
+ * @brief Parámetros del controlador adaptativo
+ */
+struct OperatorRateSettings {
+    bool enabled = false;
+    int window = 10;                        // Generaciones que abarca el crédito
+    double minProbability = 0.05;           // Parte mínima de cada brazo dentro de su grupo
+
+    // Límites de las tasas resultantes
+    float minMutation = 0.0f;
+    float maxMutation = 1.0f;
+    float minCrossover = 0.0f;
+    float maxCrossover = 1.0f;
+};
+
+/**
+ * @brief Ajusta las tasas de los operadores cada generación según su crédito
+ *
+ * Dos grupos de brazos con probability matching:
+ * - Mutación (InterChromosome, ReciprocalExchange, Shift): el presupuesto total
+ *   de mutación (suma de las tasas) se conserva y se reparte según la calidad
+ *   de cada operador: p_i = pmin + (1 - 3 pmin) q_i / Σq.
+ * - Cruza contra copia: la tasa de cruza es la probabilidad del brazo de cruza,
+ *   p = pmin + (1 - 2 pmin) q_cruza / (q_cruza + q_copia).
+ *
+ * La calidad q de un brazo es su crédito por aplicación en las últimas 'window'
+ * generaciones. Cada actualización cuesta O(brazos × ventana); el motor la llama
+ * al cerrar cada generación (EvolutionaryAlgorithm::setOperatorRateController).
+ * No es segura entre hilos: la usa solo quien conduce al motor.
+ */
+class OperatorRateController {
+public:
+    explicit OperatorRateController(const OperatorRateSettings& settings = OperatorRateSettings());
+
+    /** @brief Vacía la ventana y toma las tasas actuales como punto de partida */
+    void reset(const QVector<float>& mutationRates, float crossoverRate);
+
+    /**
+     * @brief Cambia las tasas sin olvidar el crédito (p. ej. al aplicar un consejo externo)
+     * El nuevo presupuesto de mutación es la suma de las tasas recibidas. La tasa de
+     * cruza se lleva a [pmin, 1 - pmin] para que cruza y copia reciban aplicaciones.
+     */
+    void rebase(const QVector<float>& mutationRates, float crossoverRate);
+
+    /** @brief Agrega el crédito de una generación y recalcula las tasas */
+    void update(const OperatorCredit& credit);
+
+    const QVector<float>& mutationRates() const { return rates; }
+    float crossoverRate() const { return crossover; }
+
+    /** @brief Crédito por aplicación de cada brazo en la ventana (-1 = sin aplicaciones) */
+    std::array<double, OperatorArmCount> quality() const;
+
+    const OperatorRateSettings& settings() const { return config; }
+
+private:
+    OperatorRateSettings config;
+    QVector<OperatorCredit> history;        // Anillo de a lo sumo 'window' generaciones
+    int next = 0;                           // Próxima posición a sobrescribir
+    OperatorCredit total;                   // Suma de la ventana
+
+    QVector<float> rates;
+    float crossover = 0.0f;
+    float mutationBudget = 0.0f;            // Suma de las tasas de mutación que se reparte
+};
+
+#endif // OPERATOR_RATE_CONTROLLER_H
@@ -0,0 +1,234 @@
+#include "promptdigest.h"
+
+#include <QStringList>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// Cuantil por interpolación lineal sobre una muestra ya ordenada
+double quantile(const QVector<double>& sorted, double q) {
+    const double position = q * (sorted.size() - 1);
+    const int lower = static_cast<int>(std::floor(position));
+    const int upper = std::min<int>(lower + 1, sorted.size() - 1);
+    const double weight = position - lower;
+    return sorted[lower] * (1.0 - weight) + sorted[upper] * weight;
+}
+
+QString formatDistribution(const QString& name, const DistributionSummary& d) {
+    return QString("%1: min %2, p25 %3, mediana %4, p75 %5, max %6, media %7\n")
+        .arg(name)
+        .arg(d.min, 0, 'g', 5)
+        .arg(d.p25, 0, 'g', 5)
+        .arg(d.median, 0, 'g', 5)
+        .arg(d.p75, 0, 'g', 5)
+        .arg(d.max, 0, 'g', 5)
+        .arg(d.mean, 0, 'g', 5);
+}
+
+QString formatObjectives(const Individual& individual, int c) {
+    if (c >= individual.chromosomes.size()) {
+        return "-";
+    }
+    const Chromosome& chromosome = individual.chromosomes[c];
+    return QString("(%1, %2)").arg(chromosome.f1, 0, 'g', 6).arg(chromosome.f2, 0, 'g', 6);
+}
+
+} // namespace
+
+// ================= Distribuciones =================
+
+DistributionSummary summarizeDistribution(QVector<double> values) {
+    DistributionSummary summary;
+    if (values.isEmpty()) {
+        return summary;
+    }
+
+    std::sort(values.begin(), values.end());
+    summary.count = values.size();
+    summary.min = values.first();
+    summary.max = values.last();
+    summary.p25 = quantile(values, 0.25);
+    summary.median = quantile(values, 0.5);
+    summary.p75 = quantile(values, 0.75);
+
+    double sum = 0.0;
+    for (double value : values) {
+        sum += value;
+    }
+    summary.mean = sum / values.size();
+    return summary;
+}
+
+// ================= Escenario =================
+
+QString scenarioDigest(const ScenarioData& scenario) {
+    QVector<double> times;
+    QVector<double> energies;
+    QVector<double> eligibleMachines;
+    times.reserve(scenario.numOperations * scenario.numMachines);
+    energies.reserve(scenario.numOperations * scenario.numMachines);
+
+    // Mínimos por operación (cualquier máquina): base de las cotas inferiores
+    QVector<double> minTime(scenario.processingTime.size(), 0.0);
+    QVector<double> minEnergy(scenario.energyCost.size(), 0.0);
+
+    for (int op = 0; op < scenario.processingTime.size(); ++op) {
+        double best = std::numeric_limits<double>::max();
+        int eligible = 0;
+        for (double t : scenario.processingTime[op]) {
+            // Un tiempo no positivo se toma como máquina no elegible
+            if (t > 0.0) {
+                times.append(t);
+                best = std::min(best, t);
+                eligible++;
+            }
+        }
+        minTime[op] = eligible > 0 ? best : 0.0;
+        eligibleMachines.append(eligible);
+    }
+
+    for (int op = 0; op < scenario.energyCost.size(); ++op) {
+        double best = std::numeric_limits<double>::max();
+        for (double e : scenario.energyCost[op]) {
+            if (e > 0.0) {
+                energies.append(e);
+                best = std::min(best, e);
+            }
+        }
+        minEnergy[op] = best < std::numeric_limits<double>::max() ? best : 0.0;
+    }
+
+    // Cotas inferiores: carga repartida, ruta más larga de un trabajo, energía mínima
+    QVector<double> operationsPerJob;
+    double totalMinTime = 0.0;
+    double longestJob = 0.0;
+    double totalMinEnergy = 0.0;
+    for (const Job& job : scenario.jobs) {
+        operationsPerJob.append(job.operations.size());
+        double jobTime = 0.0;
+        for (int op : job.operations) {
+            if (op >= 0 && op < minTime.size()) {
+                jobTime += minTime[op];
+            }
+            if (op >= 0 && op < minEnergy.size()) {
+                totalMinEnergy += minEnergy[op];
+            }
+        }
+        totalMinTime += jobTime;
+        longestJob = std::max(longestJob, jobTime);
+    }
+    const double loadBound = scenario.numMachines > 0 ? totalMinTime / scenario.numMachines : 0.0;
+
+    QString digest;
+    digest += QString("Máquinas: %1, operaciones distintas: %2, trabajos: %3, operaciones a programar: %4\n")
+                  .arg(scenario.numMachines)
+                  .arg(scenario.numOperations)
+                  .arg(scenario.numJobs)
+                  .arg(scenario.totalOperations);
+    digest += formatDistribution("Operaciones por trabajo", summarizeDistribution(operationsPerJob));
+    digest += formatDistribution("Máquinas elegibles por operación", summarizeDistribution(eligibleMachines));
+    digest += formatDistribution("Tiempo de procesamiento", summarizeDistribution(times));
+    digest += formatDistribution("Costo energético", summarizeDistribution(energies));
+    digest += QString("Cota inferior de makespan: %1 (carga repartida %2, trabajo más largo %3)\n")
+                  .arg(std::max(loadBound, longestJob), 0, 'g', 6)
+                  .arg(loadBound, 0, 'g', 6)
+                  .arg(longestJob, 0, 'g', 6);
+    digest += QString("Cota inferior de energía: %1\n").arg(totalMinEnergy, 0, 'g', 6);
+    return digest;
+}
+
+// ================= Frente actual =================
+
+QString frontDigest(const QVector<QString>& policyNames,
+                    const Individual& kneePoint,
+                    const Individual& bestMakespan,
+                    const Individual& bestEnergy,
+                    const QVector<int>& frontSizes) {
+    QString digest = "Por política, (makespan, energía) de cada solución de referencia:\n";
+    for (int c = 0; c < policyNames.size(); ++c) {
+        digest += QString("%1: rodilla %2, mejor makespan %3, mejor energía %4")
+                      .arg(policyNames[c])
+                      .arg(formatObjectives(kneePoint, c))
+                      .arg(formatObjectives(bestMakespan, c))
+                      .arg(formatObjectives(bestEnergy, c));
+        if (c < frontSizes.size()) {
+            digest += QString(", %1 soluciones no dominadas").arg(frontSizes[c]);
+        }
+        digest += "\n";
+    }
+    return digest;
+}
+
+// ================= Hipervolumen =================
+
+QString hypervolumeTrendDigest(const QVector<QVector<double>>& hypervolumes,
+                               const QVector<HypervolumeStats>& hypervolumeStats,
+                               const QVector<QString>& policyNames) {
+    QString digest = QString("Ventana de las últimas %1 generaciones, por política:\n")
+                         .arg(hypervolumes.size());
+
+    for (int c = 0; c < policyNames.size(); ++c) {
+        QVector<double> series;
+        for (const QVector<double>& row : hypervolumes) {
+            if (c < row.size()) {
+                series.append(row[c]);
+            }
+        }
+        if (series.isEmpty()) {
+            continue;
+        }
+
+        // Pendiente por mínimos cuadrados (hipervolumen por generación)
+        const int n = series.size();
+        double slope = 0.0;
+        if (n > 1) {
+            const double meanX = (n - 1) / 2.0;
+            double meanY = 0.0;
+            for (double y : series) {
+                meanY += y;
+            }
+            meanY /= n;
+
+            double sxy = 0.0;
+            double sxx = 0.0;
+            for (int i = 0; i < n; ++i) {
+                sxy += (i - meanX) * (series[i] - meanY);
+                sxx += (i - meanX) * (i - meanX);
+            }
+            slope = sxy / sxx;
+        }
+
+        // Generaciones desde la última mejora dentro de la ventana
+        int bestIndex = 0;
+        for (int i = 1; i < n; ++i) {
+            if (series[i] > series[bestIndex]) {
+                bestIndex = i;
+            }
+        }
+
+        const double first = series.first();
+        const double last = series.last();
+        const double relativeChange = first != 0.0 ? (last - first) / std::abs(first) : 0.0;
+
+        digest += QString("%1: último %2, cambio %3 (%4%), pendiente %5/gen, sin mejora desde hace %6 gen")
+                      .arg(policyNames[c])
+                      .arg(last, 0, 'g', 6)
+                      .arg(last - first, 0, 'g', 4)
+                      .arg(relativeChange * 100.0, 0, 'f', 2)
+                      .arg(slope, 0, 'g', 4)
+                      .arg(n - 1 - bestIndex);
+
+        if (c < hypervolumeStats.size() && hypervolumeStats[c].count > 0) {
+            const HypervolumeStats& stats = hypervolumeStats[c];
+            digest += QString(", corrida: min %1, max %2, media %3, desv. %4")
+                          .arg(stats.min, 0, 'g', 6)
+                          .arg(stats.max, 0, 'g', 6)
+                          .arg(stats.mean, 0, 'g', 6)
+                          .arg(std::sqrt(stats.variance()), 0, 'g', 4);
+        }
+        digest += "\n";
+    }
+    return digest;
+}
@@ -0,0 +1,66 @@
+#ifndef PROMPT_DIGEST_H
+#define PROMPT_DIGEST_H
+
+#include <QString>
+#include <QVector>
+#include "scenariodata.h"
+#include "individual.h"
+#include "EvolutionaryAlgorithm.h"      // HypervolumeStats
+
+/**
+ * @file PromptDigest.h
+ * @brief Resúmenes de tamaño acotado para el prompt del LLM
+ *
+ * En lugar del archivo del escenario y de los genes completos, el prompt lleva
+ * conteos, distribuciones y tendencias. El tamaño depende solo del número de
+ * políticas, no del número de operaciones, máquinas o generaciones.
+ */
+
+/**
+ * @brief Cuantiles de una muestra (para tiempos y energías)
+ */
+struct DistributionSummary {
+    int count = 0;
+    double min = 0.0;
+    double p25 = 0.0;
+    double median = 0.0;
+    double p75 = 0.0;
+    double max = 0.0;
+    double mean = 0.0;
+};
+
+/** @brief Mínimo, cuartiles, máximo y media (la muestra se recibe por copia y se ordena) */
+DistributionSummary summarizeDistribution(QVector<double> values);
+
+/**
+ * @brief Resumen estadístico del escenario (se calcula una vez por corrida)
+ *
+ * Conteos de máquinas, operaciones y trabajos, distribución de tiempos y energías,
+ * máquinas elegibles por operación y cotas inferiores simples de makespan y energía.
+ */
+QString scenarioDigest(const ScenarioData& scenario);
+
+/**
+ * @brief Objetivos (f1, f2) de las soluciones de referencia por política, sin genes
+ * @param frontSizes Soluciones no dominadas por política (puede venir vacío)
+ */
+QString frontDigest(const QVector<QString>& policyNames,
+                    const Individual& kneePoint,
+                    const Individual& bestMakespan,
+                    const Individual& bestEnergy,
+                    const QVector<int>& frontSizes);
+
+/**
+ * @brief Tendencia del hipervolumen por política en la ventana reciente
+ *
+ * Último valor, mejor valor, cambio y pendiente en la ventana, generaciones desde
+ * la última mejora y el rango de toda la corrida.
+ *
+ * @param hypervolumes Ventana reciente: hypervolumes[g][política]
+ * @param hypervolumeStats Estadísticas acumuladas de toda la corrida
+ */
+QString hypervolumeTrendDigest(const QVector<QVector<double>>& hypervolumes,
+                               const QVector<HypervolumeStats>& hypervolumeStats,
+                               const QVector<QString>& policyNames);
+
+#endif // PROMPT_DIGEST_H
@@ -0,0 +1,153 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <cstdint>
+
+/**
+ * @file Rng.h
+ * @brief Generador xoshiro256++ con saltos para obtener flujos independientes
+ *
+ * Es pequeño (32 bytes de estado), rápido y cumple con UniformRandomBitGenerator,
+ * por lo que puede usarse con las distribuciones de <random>.
+ *
+ * A partir de una sola semilla de ejecución se derivan flujos disjuntos:
+ * - jump()     avanza 2^128 posiciones (un flujo por hilo/isla)
+ * - longJump() avanza 2^192 posiciones (un flujo por proceso/experimento)
+ * - split()    devuelve el flujo actual y salta este generador al siguiente
+ * - keyed()    flujo derivado de una clave y un elemento de trabajo (modo determinista)
+ */
+class Rng {
+public:
+    using result_type = std::uint64_t;
+
+    /**
+     * @brief Inicializa el estado expandiendo la semilla con SplitMix64
+     * (así incluso semillas pequeñas o parecidas dan estados bien distintos)
+     */
+    explicit Rng(std::uint64_t seed = 0) { reseed(seed); }
+
+    void reseed(std::uint64_t seed) {
+        std::uint64_t x = seed;
+        for (std::uint64_t& word : s) {
+            word = splitMix64(x);
+        }
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~result_type(0); }
+
+    result_type operator()() {
+        const std::uint64_t result = rotl(s[0] + s[3], 23) + s[0];
+        const std::uint64_t t = s[1] << 17;
+
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+
+        return result;
+    }
+
+    /** @brief Double uniforme en [0, 1) con 53 bits de precisión */
+    double uniform01() {
+        return static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+    }
+
+    /** @brief Entero uniforme en [0, bound) (método de Lemire, sin división en el caso común) */
+    std::uint32_t bounded(std::uint32_t bound) {
+        std::uint64_t m = static_cast<std::uint64_t>(static_cast<std::uint32_t>((*this)() >> 32)) * bound;
+        std::uint32_t low = static_cast<std::uint32_t>(m);
+        if (low < bound) {
+            const std::uint32_t threshold = static_cast<std::uint32_t>(-bound) % bound;
+            while (low < threshold) {
+                m = static_cast<std::uint64_t>(static_cast<std::uint32_t>((*this)() >> 32)) * bound;
+                low = static_cast<std::uint32_t>(m);
+            }
+        }
+        return static_cast<std::uint32_t>(m >> 32);
+    }
+
+    /** @brief Equivalente a 2^128 llamadas a operator() */
+    void jump() {
+        static const std::uint64_t JUMP[] = {
+            0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+            0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL
+        };
+        applyJump(JUMP);
+    }
+
+    /** @brief Equivalente a 2^192 llamadas a operator() */
+    void longJump() {
+        static const std::uint64_t LONG_JUMP[] = {
+            0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL,
+            0x77710069854ee241ULL, 0x39109bb02acbe635ULL
+        };
+        applyJump(LONG_JUMP);
+    }
+
+    /**
+     * @brief Separa un flujo independiente
+     * @return Copia del estado actual; este generador salta 2^128 posiciones
+     */
+    Rng split() {
+        Rng stream = *this;
+        jump();
+        return stream;
+    }
+
+    /**
+     * @brief Flujo ligado a un elemento lógico de trabajo (fase, índice), no a un hilo
+     *
+     * Los mismos (key, phase, index) producen siempre la misma secuencia,
+     * sin importar qué hilo ni en qué orden se consuma.
+     */
+    static Rng keyed(std::uint64_t key, std::uint64_t phase, std::uint64_t index) {
+        std::uint64_t h = splitMix64(key) ^ phase;
+        h = splitMix64(h) ^ index;
+        return Rng(splitMix64(h));
+    }
+
+    /** @brief Paso de SplitMix64 (también útil para mezclar semillas) */
+    static std::uint64_t splitMix64(std::uint64_t& x) {
+        std::uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    bool operator==(const Rng& other) const {
+        return s[0] == other.s[0] && s[1] == other.s[1] &&
+               s[2] == other.s[2] && s[3] == other.s[3];
+    }
+    bool operator!=(const Rng& other) const { return !(*this == other); }
+
+private:
+    std::uint64_t s[4];
+
+    static std::uint64_t rotl(std::uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    void applyJump(const std::uint64_t (&table)[4]) {
+        std::uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        for (std::uint64_t word : table) {
+            for (int b = 0; b < 64; b++) {
+                if (word & (std::uint64_t(1) << b)) {
+                    s0 ^= s[0];
+                    s1 ^= s[1];
+                    s2 ^= s[2];
+                    s3 ^= s[3];
+                }
+                (*this)();
+            }
+        }
+        s[0] = s0;
+        s[1] = s1;
+        s[2] = s2;
+        s[3] = s3;
+    }
+};
+
+#endif // RNG_H
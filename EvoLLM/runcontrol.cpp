@@ -0,0 +1,91 @@
+#include "runcontrol.h"
+
+std::int64_t RunControl::nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now().time_since_epoch()).count();
+}
+
+void RunControl::reset() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop.store(false);
+        paused.store(false);
+    }
+    resumed.notify_all();
+}
+
+void RunControl::start(double maxSeconds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const std::int64_t now = nowNs();
+    startNs.store(now);
+    pausedNs.store(0);
+    if (paused.load()) {
+        pauseStartNs = now;             // La pausa cuenta desde aquí
+    }
+    deadlineNs.store(maxSeconds > 0.0 ? now + static_cast<std::int64_t>(maxSeconds * 1e9) : 0);
+}
+
+void RunControl::requestStop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop.store(true);
+    }
+    resumed.notify_all();
+}
+
+bool RunControl::timeExpired() const {
+    const std::int64_t deadline = deadlineNs.load(std::memory_order_relaxed);
+    return deadline != 0 && !paused.load(std::memory_order_relaxed) && nowNs() >= deadline;
+}
+
+bool RunControl::stopRequested() const {
+    return stop.load(std::memory_order_relaxed) || timeExpired();
+}
+
+void RunControl::pause() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!paused.load()) {
+        pauseStartNs = nowNs();
+        paused.store(true);
+    }
+}
+
+void RunControl::resume() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!paused.load()) {
+            return;
+        }
+        // El tiempo en pausa no cuenta contra el presupuesto
+        const std::int64_t pausedFor = nowNs() - pauseStartNs;
+        pausedNs.fetch_add(pausedFor);
+        if (deadlineNs.load() != 0) {
+            deadlineNs.fetch_add(pausedFor);
+        }
+        paused.store(false);
+    }
+    resumed.notify_all();
+}
+
+bool RunControl::isPaused() const {
+    return paused.load(std::memory_order_relaxed);
+}
+
+bool RunControl::checkpoint() {
+    if (paused.load(std::memory_order_acquire)) {
+        std::unique_lock<std::mutex> lock(mutex);
+        resumed.wait(lock, [this] { return !paused.load() || stop.load(); });
+    }
+    return !stopRequested();
+}
+
+double RunControl::elapsedSeconds() const {
+    std::int64_t end = nowNs();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (paused.load()) {
+            end = pauseStartNs;
+        }
+    }
+    return (end - startNs.load() - pausedNs.load()) / 1e9;
+}
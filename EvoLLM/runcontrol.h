@@ -0,0 +1,100 @@
+#ifndef RUN_CONTROL_H
+#define RUN_CONTROL_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+/**
+ * @file RunControl.h
+ * @brief Presupuesto de una corrida y control cooperativo de parada/pausa
+ */
+
+/**
+ * @brief Límites de una corrida (0 = sin límite en ese criterio)
+ *
+ * La corrida termina con el primer criterio que se cumpla. Al menos uno debe estar
+ * activo, o evolve() no termina nunca (salvo con RunControl::requestStop()).
+ */
+struct RunBudget {
+    int maxGenerations = 0;
+    long long maxEvaluations = 0;           // No se empieza una generación que lo exceda
+    double maxSeconds = 0.0;                // Tiempo de pared de evolve(), sin contar pausas
+    int stagnationGenerations = 0;          // Generaciones seguidas sin mejora del hipervolumen
+    double stagnationTolerance = 1e-4;      // Mejora relativa mínima para contar como mejora
+};
+
+/**
+ * @brief Por qué terminó una corrida
+ */
+enum class StopReason {
+    None,                                   // Sigue en curso
+    Generations,
+    Evaluations,
+    Time,
+    Stagnation,
+    Cancelled                               // Parada pedida desde fuera
+};
+
+/**
+ * @brief Señales de parada y pausa compartidas entre la interfaz y el motor
+ *
+ * Todos los métodos son seguros entre hilos. El motor llama a checkpoint() al
+ * empezar cada chunk de trabajo: si la corrida está en pausa el hilo se bloquea
+ * ahí, y si se pidió detenerla (o se agotó el tiempo) la generación en curso se
+ * abandona y la población queda como estaba al final de la anterior.
+ */
+class RunControl {
+public:
+    /** @brief Quita la parada y la pausa de una corrida anterior */
+    void reset();
+
+    /**
+     * @brief Pone el reloj en cero y arma el límite de tiempo (lo llama evolve())
+     * No borra una parada pedida antes: esa corrida termina de inmediato.
+     * @param maxSeconds Límite de tiempo (0 = sin límite)
+     */
+    void start(double maxSeconds = 0.0);
+
+    /** @brief Pide detener la corrida (también despierta a los hilos en pausa) */
+    void requestStop();
+
+    /** @brief true si se pidió detener o si se agotó el tiempo */
+    bool stopRequested() const;
+
+    /** @brief true si hay límite de tiempo y ya se cumplió */
+    bool timeExpired() const;
+
+    void pause();
+    void resume();
+    bool isPaused() const;
+
+    /**
+     * @brief Punto de control cooperativo (una vez por chunk)
+     * Bloquea mientras la corrida esté en pausa.
+     * @return false si el trabajo en curso debe abandonarse
+     */
+    bool checkpoint();
+
+    /** @brief Segundos transcurridos desde start(), sin contar pausas */
+    double elapsedSeconds() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static std::int64_t nowNs();
+
+    std::atomic<bool> stop{false};
+    std::atomic<bool> paused{false};
+    std::atomic<std::int64_t> startNs{0};
+    std::atomic<std::int64_t> deadlineNs{0};    // Absoluto; 0 = sin límite (se corre al reanudar)
+    std::atomic<std::int64_t> pausedNs{0};      // Tiempo total en pausa
+
+    mutable std::mutex mutex;
+    std::condition_variable resumed;
+    std::int64_t pauseStartNs = 0;              // Protegido por mutex
+};
+
+#endif // RUN_CONTROL_H
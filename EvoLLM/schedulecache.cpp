@@ -0,0 +1,62 @@
+#include "schedulecache.h"
+#include <QHash>
+#include <algorithm>
+
+ScheduleCache::ScheduleCache(std::shared_ptr<const EvolutionaryAlgorithm> engine, int capacity)
+    : engine(std::move(engine))
+    , capacity(std::max(1, capacity)) {
+}
+
+std::shared_ptr<const DecodedSchedule>
+ScheduleCache::findLocked(int policyId, size_t hash, const QVector<int>& genes) {
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+        if (it->policyId == policyId && it->hash == hash && it->genes == genes) {
+            entries.splice(entries.begin(), entries, it);
+            return entries.front().schedule;
+        }
+    }
+    return nullptr;
+}
+
+std::shared_ptr<const DecodedSchedule> ScheduleCache::get(int policyId, const QVector<int>& genes) {
+    const size_t hash = qHash(genes);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (auto found = findLocked(policyId, hash, genes)) {
+            hits++;
+            return found;
+        }
+        misses++;
+    }
+
+    // Se decodifica sin el candado; el motor no se modifica
+    auto decoded = std::make_shared<const DecodedSchedule>(engine->decodeSchedule(policyId, genes));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    // Otro hilo pudo haberlo insertado mientras tanto: se conserva el primero
+    if (auto found = findLocked(policyId, hash, genes)) {
+        return found;
+    }
+    entries.push_front({policyId, hash, genes, decoded});
+    if (static_cast<int>(entries.size()) > capacity) {
+        entries.pop_back();
+    }
+    return decoded;
+}
+
+void ScheduleCache::prefetch(const Individual& individual) {
+    for (int c = 0; c < individual.chromosomes.size(); ++c) {
+        get(c, individual.chromosomes[c].genes);
+    }
+}
+
+int ScheduleCache::getHits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return hits;
+}
+
+int ScheduleCache::getMisses() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return misses;
+}
@@ -0,0 +1,61 @@
+#ifndef SCHEDULECACHE_H
+#define SCHEDULECACHE_H
+
+#include <QVector>
+#include <list>
+#include <memory>
+#include <mutex>
+#include "EvolutionaryAlgorithm.h"
+#include "scheduletypes.h"
+
+/**
+ * @brief Caché LRU de programaciones decodificadas
+ *
+ * Las vistas de resultados (Gantt, exportación, resumen) piden la programación de
+ * los mismos pocos cromosomas: mejor makespan, mejor energía, punto de rodilla y
+ * algunos del archivo. Cada uno se decodifica una sola vez con
+ * EvolutionaryAlgorithm::decodeSchedule() (const) y se comparte como
+ * std::shared_ptr<const DecodedSchedule>.
+ *
+ * Es segura entre hilos: la decodificación se hace fuera del candado, así que dos
+ * hilos pueden decodificar cromosomas distintos a la vez.
+ */
+class ScheduleCache
+{
+public:
+    /**
+     * @param engine Motor que decodifica (solo se usan métodos const)
+     * @param capacity Número máximo de programaciones guardadas
+     */
+    explicit ScheduleCache(std::shared_ptr<const EvolutionaryAlgorithm> engine, int capacity = 32);
+
+    /** @brief Programación de unos genes de la política indicada (decodifica si no está) */
+    std::shared_ptr<const DecodedSchedule> get(int policyId, const QVector<int>& genes);
+
+    /** @brief Decodifica por adelantado todos los cromosomas de un individuo */
+    void prefetch(const Individual& individual);
+
+    int getHits() const;
+    int getMisses() const;
+
+private:
+    struct Entry {
+        int policyId;
+        size_t hash;
+        QVector<int> genes;
+        std::shared_ptr<const DecodedSchedule> schedule;
+    };
+
+    std::shared_ptr<const EvolutionaryAlgorithm> engine;
+    int capacity;
+
+    mutable std::mutex mutex;
+    std::list<Entry> entries;               // Más reciente al frente
+    int hits = 0;
+    int misses = 0;
+
+    // Busca y, si lo encuentra, lo mueve al frente (requiere el candado)
+    std::shared_ptr<const DecodedSchedule> findLocked(int policyId, size_t hash, const QVector<int>& genes);
+};
+
+#endif // SCHEDULECACHE_H
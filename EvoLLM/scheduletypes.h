@@ -1,6 +1,8 @@
 #ifndef SCHEDULE_TYPES_H
 #define SCHEDULE_TYPES_H
 
+#include <QVector>
+
 /**
  * @file ScheduleTypes.h
  * @brief Definiciones de estructuras utilizadas durante la simulación y evaluación
@@ -43,6 +45,33 @@ struct OperationSchedule {
     double energyCost = 0.0;        // Consumo energético real de esta operación en la máquina elegida
 };
 
+/**
+ * @brief Operación programada en su forma compacta (solo lo necesario para dibujarla)
+ *
+ * El tiempo de procesamiento y la energía se pueden recuperar del escenario; aquí
+ * solo se guarda dónde y cuándo se ejecutó.
+ */
+struct ScheduledOperation {
+    int jobId = -1;
+    int operationId = -1;
+    int machineId = -1;
+    double startTime = 0.0;
+    double endTime = 0.0;
+};
+
+/**
+ * @brief Programación completa de un cromosoma, decodificada una sola vez
+ *
+ * Es inmutable una vez construida, así que se comparte (std::shared_ptr<const>)
+ * entre el Gantt, la exportación y el resumen sin volver a decodificar.
+ */
+struct DecodedSchedule {
+    int numMachines = 0;
+    double makespan = 0.0;
+    double energy = 0.0;
+    QVector<ScheduledOperation> operations;     // En el orden en que se programaron
+};
+
 /**
  * @brief Representa el estado de progreso de un trabajo (job) durante la simulación
  * 
@@ -0,0 +1,585 @@
+#include "shmislands.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDebug>
+#include <QProcess>
+#include <QSharedMemory>
+#include <QStringList>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <random>
+#include <vector>
+#include "individualcodec.h"
+#include "islandmodel.h"
+#include "ScenarioLoader.h"
+
+// ================= Diseño del segmento compartido =================
+
+namespace {
+
+const quint32 kMagic = 0x45564F49;              // "EVOI"
+const quint32 kLayoutVersion = 2;
+const int kPollMs = 50;
+
+static_assert(std::atomic<qint64>::is_always_lock_free &&
+              std::atomic<quint64>::is_always_lock_free &&
+              std::atomic<qint32>::is_always_lock_free,
+              "Los atomicos en memoria compartida deben ser libres de bloqueo");
+
+enum IslandState {
+    IslandPending = 0,
+    IslandRunning,
+    IslandFinished
+};
+
+// Parámetros de la corrida (escritos una sola vez por el coordinador)
+struct SharedHeader {
+    quint32 magic;
+    quint32 layoutVersion;
+    qint32 numIslands;
+    qint32 numPolicies;
+    qint32 numGenerations;
+    qint32 migrationInterval;
+    qint32 migrantsPerExchange;
+    qint32 ringSlots;
+    qint32 populationSize;
+    qint32 geneCount;
+    qint32 slotBytes;
+    qint32 populationBytes;
+    float crossoverRate;
+    float mutationRates[MutationCount];
+    quint64 seed;
+    char scenarioPath[1024];
+    char policyNames[512];                      // Separadas por ','
+};
+
+// Estado vivo de cada isla; los índices del anillo van en líneas de caché distintas
+struct alignas(64) IslandHeader {
+    std::atomic<qint32> state;
+    std::atomic<qint32> sampleRows;             // Filas de objetivos publicadas
+    std::atomic<qint64> heartbeatMs;
+    alignas(64) std::atomic<quint64> inboxHead; // Consumidor: esta isla
+    alignas(64) std::atomic<quint64> inboxTail; // Productor: la isla anterior del anillo
+
+    // Población en doble búfer: cada búfer tiene su versión (impar = escritura en
+    // curso, par = copia completa). Se escribe siempre sobre el más antiguo, así que
+    // si el proceso muere a mitad el otro conserva la última población completa.
+    alignas(64) std::atomic<quint64> populationVersion[2];
+    qint32 populationSize[2];                   // Bytes válidos de cada búfer
+    quint64 populationsPublished;               // Solo lo usa el trabajador
+};
+
+// Generaciones en que cada isla publica los objetivos de su población:
+// la inicial, cada K generaciones y la última
+int sampleRowCount(const SharedHeader& h) {
+    return h.numGenerations / h.migrationInterval + 1 + (h.numGenerations % h.migrationInterval != 0 ? 1 : 0);
+}
+
+int sampleGeneration(const SharedHeader& h, int row) {
+    return std::min(row * h.migrationInterval, h.numGenerations);
+}
+
+bool isSampleGeneration(const SharedHeader& h, int generation) {
+    return generation % h.migrationInterval == 0 || generation == h.numGenerations;
+}
+
+qint64 align64(qint64 bytes) {
+    return (bytes + 63) & ~qint64(63);
+}
+
+/**
+ * Bloque de cada isla:
+ *   IslandHeader | objetivos[filas][políticas][población](f1, f2) | anillo[ringSlots] | población × 2
+ * Cada ranura del anillo es: int32 bytes | lote codificado
+ */
+class SharedLayout {
+public:
+    explicit SharedLayout(void* base)
+        : base(static_cast<char*>(base)) {}
+
+    static qint64 totalBytes(const SharedHeader& h) {
+        return align64(sizeof(SharedHeader)) + h.numIslands * islandBytes(h);
+    }
+
+    SharedHeader* header() const {
+        return reinterpret_cast<SharedHeader*>(base);
+    }
+
+    IslandHeader* island(int i) const {
+        return reinterpret_cast<IslandHeader*>(islandBase(i));
+    }
+
+    // Pares (f1, f2) de la población de la isla i en la fila 'row' para la política c
+    double* objectives(int i, int row, int c) const {
+        const SharedHeader& h = *header();
+        return reinterpret_cast<double*>(islandBase(i) + objectivesOffset()) +
+               (qint64(row) * h.numPolicies + c) * h.populationSize * 2;
+    }
+
+    char* slot(int i, quint64 n) const {
+        const SharedHeader& h = *header();
+        return islandBase(i) + ringOffset(h) + (n % h.ringSlots) * slotStride(h);
+    }
+
+    char* population(int i, int buffer) const {
+        const SharedHeader& h = *header();
+        return islandBase(i) + ringOffset(h) + h.ringSlots * slotStride(h) +
+               buffer * align64(h.populationBytes);
+    }
+
+private:
+    char* base;
+
+    static qint64 objectivesOffset() {
+        return align64(sizeof(IslandHeader));
+    }
+    static qint64 ringOffset(const SharedHeader& h) {
+        return objectivesOffset() +
+               align64(qint64(sampleRowCount(h)) * h.numPolicies * h.populationSize * 2 * sizeof(double));
+    }
+    static qint64 slotStride(const SharedHeader& h) {
+        return align64(sizeof(qint32) + h.slotBytes);
+    }
+    static qint64 islandBytes(const SharedHeader& h) {
+        return ringOffset(h) + h.ringSlots * slotStride(h) + 2 * align64(h.populationBytes);
+    }
+
+    char* islandBase(int i) const {
+        return base + align64(sizeof(SharedHeader)) + i * islandBytes(*header());
+    }
+};
+
+qint64 nowMs() {
+    return QDateTime::currentMSecsSinceEpoch();
+}
+
+// ---- Anillo SPSC de migrantes (mismo protocolo que SpscQueue, entre procesos) ----
+
+bool pushMigrants(const SharedLayout& layout, int to, const QByteArray& batch) {
+    const SharedHeader& h = *layout.header();
+    IslandHeader* target = layout.island(to);
+
+    if (batch.size() > h.slotBytes) {
+        return false;
+    }
+
+    const quint64 tail = target->inboxTail.load(std::memory_order_relaxed);
+    if (tail - target->inboxHead.load(std::memory_order_acquire) >= quint64(h.ringSlots)) {
+        return false;                           // Vecina atrasada (o muerta): se descarta
+    }
+
+    char* slot = layout.slot(to, tail);
+    const qint32 bytes = batch.size();
+    std::memcpy(slot, &bytes, sizeof(bytes));
+    std::memcpy(slot + sizeof(bytes), batch.constData(), bytes);
+
+    target->inboxTail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+QVector<Individual> popMigrants(const SharedLayout& layout, int index,
+                                const QVector<QString>& policyNames) {
+    IslandHeader* island = layout.island(index);
+    QVector<Individual> immigrants;
+    QVector<Individual> batch;
+
+    quint64 head = island->inboxHead.load(std::memory_order_relaxed);
+    const quint64 tail = island->inboxTail.load(std::memory_order_acquire);
+
+    for (; head < tail; ++head) {
+        const char* slot = layout.slot(index, head);
+        qint32 bytes;
+        std::memcpy(&bytes, slot, sizeof(bytes));
+        if (decodeIndividuals(slot + sizeof(bytes), bytes, policyNames, batch)) {
+            immigrants += batch;
+        }
+    }
+
+    island->inboxHead.store(head, std::memory_order_release);
+    return immigrants;
+}
+
+// ---- Población publicada (doble búfer con versión por búfer) ----
+
+void publishPopulation(const SharedLayout& layout, int index, const QVector<Individual>& population) {
+    const SharedHeader& h = *layout.header();
+    IslandHeader* island = layout.island(index);
+    const QByteArray encoded = encodeIndividuals(population);
+    if (encoded.size() > h.populationBytes) {
+        return;
+    }
+
+    // Publicación n (desde 1): búfer n % 2, versión 2n al terminar
+    const quint64 n = ++island->populationsPublished;
+    const int buffer = int(n % 2);
+    std::atomic<quint64>& version = island->populationVersion[buffer];
+
+    version.store(2 * n - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::memcpy(layout.population(index, buffer), encoded.constData(), encoded.size());
+    island->populationSize[buffer] = encoded.size();
+
+    version.store(2 * n, std::memory_order_release);
+}
+
+// Última población completa: primero el búfer más reciente y, si se está
+// escribiendo (o el proceso murió a mitad), el anterior
+bool readPopulation(const SharedLayout& layout, int index,
+                    const QVector<QString>& policyNames, QVector<Individual>& out) {
+    const SharedHeader& h = *layout.header();
+    IslandHeader* island = layout.island(index);
+    QByteArray copy(h.populationBytes, Qt::Uninitialized);
+
+    for (int attempt = 0; attempt < 100; ++attempt) {
+        const quint64 versions[2] = {
+            island->populationVersion[0].load(std::memory_order_acquire),
+            island->populationVersion[1].load(std::memory_order_acquire)
+        };
+        const int newest = versions[1] > versions[0] ? 1 : 0;
+
+        for (int buffer : {newest, 1 - newest}) {
+            const quint64 before = versions[buffer];
+            if (before == 0 || (before & 1)) {
+                continue;                       // Vacío o escritura sin terminar
+            }
+
+            const int bytes = std::min<int>(island->populationSize[buffer], h.populationBytes);
+            std::memcpy(copy.data(), layout.population(index, buffer), bytes);
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (island->populationVersion[buffer].load(std::memory_order_relaxed) == before) {
+                return decodeIndividuals(copy.constData(), bytes, policyNames, out);
+            }
+        }
+
+        if (versions[0] == 0 && versions[1] == 0) {
+            return false;                       // Nunca publicó
+        }
+    }
+    return false;
+}
+
+// ---- Objetivos de la población en las generaciones de muestreo ----
+
+void publishObjectives(const SharedLayout& layout, int index, const QVector<Individual>& population) {
+    const SharedHeader& h = *layout.header();
+    IslandHeader* island = layout.island(index);
+    const int row = island->sampleRows.load(std::memory_order_relaxed);
+    if (row >= sampleRowCount(h)) {
+        return;
+    }
+
+    for (int c = 0; c < h.numPolicies; ++c) {
+        double* dest = layout.objectives(index, row, c);
+        for (int i = 0; i < h.populationSize; ++i) {
+            // Una población más corta (no debería pasar) deja puntos que no aportan
+            const bool present = i < population.size() && c < population[i].chromosomes.size();
+            dest[2 * i] = present ? population[i].chromosomes[c].f1 : std::numeric_limits<double>::infinity();
+            dest[2 * i + 1] = present ? population[i].chromosomes[c].f2 : std::numeric_limits<double>::infinity();
+        }
+    }
+    island->sampleRows.store(row + 1, std::memory_order_release);
+}
+
+// Hipervolumen de un conjunto de puntos cualquiera (los dominados no suman) respecto a 'ref'
+double hypervolume2D(QVector<QPair<double, double>> points, double refF1, double refF2) {
+    std::sort(points.begin(), points.end());
+
+    double volume = 0.0;
+    double bestF2 = refF2;
+    for (const QPair<double, double>& point : points) {
+        if (point.first < refF1 && point.second < bestF2) {
+            volume += (refF1 - point.first) * (bestF2 - point.second);
+            bestF2 = point.second;
+        }
+    }
+    return volume;
+}
+
+} // namespace
+
+// ================= Coordinador =================
+
+IslandCoordinator::IslandCoordinator(const ShmIslandConfig& config)
+    : config(config) {
+    if (this->config.seed == 0) {
+        std::random_device device;
+        this->config.seed = (static_cast<std::uint64_t>(device()) << 32) | device();
+    }
+    qDebug() << "Semilla del modelo de islas multiproceso:" << this->config.seed;
+}
+
+bool IslandCoordinator::run() {
+    hypervolumes.clear();
+    hypervolumeGenerations.clear();
+    globalFront.clear();
+    failedIslands.clear();
+
+    const int numPolicies = config.policyNames.size();
+    const QByteArray path = config.scenarioPath.toUtf8();
+    const QByteArray policies = QStringList(config.policyNames.begin(), config.policyNames.end())
+                                    .join(',').toUtf8();
+
+    if (config.numIslands < 1 || config.migrationInterval < 1 || config.ringSlots < 1 ||
+        config.mutationRates.size() != MutationCount || numPolicies < 1) {
+        qWarning() << "Configuracion de islas invalida";
+        return false;
+    }
+
+    // El coordinador también carga el escenario: valida la ruta y fija el tamaño de los lotes
+    ScenarioData scenario;
+    try {
+        scenario = loadScenario(config.scenarioPath, config.policyNames);
+    } catch (const std::exception& e) {
+        qWarning() << "No se pudo cargar el escenario:" << e.what();
+        return false;
+    }
+
+    SharedHeader params{};
+    if (path.size() >= int(sizeof(params.scenarioPath)) ||
+        policies.size() >= int(sizeof(params.policyNames))) {
+        qWarning() << "Ruta del escenario o lista de politicas demasiado larga";
+        return false;
+    }
+
+    params.magic = kMagic;
+    params.layoutVersion = kLayoutVersion;
+    params.numIslands = config.numIslands;
+    params.numPolicies = numPolicies;
+    params.numGenerations = config.numGenerations;
+    params.migrationInterval = config.migrationInterval;
+    params.migrantsPerExchange = config.migrantsPerExchange;
+    params.ringSlots = config.ringSlots;
+    params.populationSize = config.populationSize;
+    params.geneCount = scenario.totalOperations;
+    params.slotBytes = encodedIndividualsSize(config.migrantsPerExchange, numPolicies, scenario.totalOperations);
+    params.populationBytes = encodedIndividualsSize(config.populationSize, numPolicies, scenario.totalOperations);
+    params.crossoverRate = config.crossoverRate;
+    for (int m = 0; m < MutationCount; ++m) {
+        params.mutationRates[m] = config.mutationRates[m];
+    }
+    params.seed = config.seed;
+    std::memcpy(params.scenarioPath, path.constData(), path.size());
+    std::memcpy(params.policyNames, policies.constData(), policies.size());
+
+    const QString key = QString("EvoLLM-islands-%1-%2")
+                            .arg(QCoreApplication::applicationPid())
+                            .arg(config.seed);
+
+    // El respaldo de QSharedMemory depende de la versión de Qt: en Unix, Qt 5 usa
+    // System V; Qt 6.6 y posteriores usan memoria POSIX por omisión
+    QSharedMemory memory(key);
+    if (!memory.create(SharedLayout::totalBytes(params))) {
+        qWarning() << "No se pudo crear la memoria compartida:" << memory.errorString();
+        return false;
+    }
+
+    std::memset(memory.data(), 0, memory.size());
+    SharedLayout layout(memory.data());
+    new (layout.header()) SharedHeader(params);
+    for (int i = 0; i < config.numIslands; ++i) {
+        IslandHeader* island = new (layout.island(i)) IslandHeader();
+        island->heartbeatMs.store(nowMs());
+    }
+
+    // Un proceso por isla: el propio ejecutable en modo trabajador
+    std::vector<std::unique_ptr<QProcess>> workers;
+    for (int i = 0; i < config.numIslands; ++i) {
+        auto process = std::make_unique<QProcess>();
+        process->setProcessChannelMode(QProcess::ForwardedChannels);
+        process->start(QCoreApplication::applicationFilePath(),
+                       {"--island-worker", key, QString::number(i)});
+        workers.push_back(std::move(process));
+    }
+
+    // Vigilancia: fin normal, muerte del proceso o latido vencido
+    QVector<bool> running(config.numIslands, true);
+    int alive = config.numIslands;
+
+    while (alive > 0) {
+        for (int i = 0; i < config.numIslands; ++i) {
+            if (!running[i]) continue;
+
+            QProcess& process = *workers[i];
+            const qint64 silence = nowMs() - layout.island(i)->heartbeatMs.load();
+
+            if (process.state() != QProcess::NotRunning && silence > config.heartbeatTimeoutMs) {
+                qWarning() << "Isla" << i << "sin latido, se termina el proceso";
+                process.kill();
+            }
+
+            if (process.state() == QProcess::NotRunning || process.waitForFinished(kPollMs)) {
+                running[i] = false;
+                alive--;
+
+                const bool finished = layout.island(i)->state.load() == IslandFinished;
+                if (!finished || process.exitStatus() != QProcess::NormalExit || process.exitCode() != 0) {
+                    qWarning() << "Isla" << i << "termino de forma anomala; se conservan sus ultimos resultados";
+                    failedIslands.append(i);
+                }
+            }
+        }
+    }
+
+    // Un solo punto de referencia para todas las islas y filas, con la misma regla
+    // que el motor (peores objetivos de la población inicial + 80), pero sobre la
+    // población inicial de todas las islas
+    const SharedHeader& h = *layout.header();
+    double refF1 = -std::numeric_limits<double>::infinity();
+    double refF2 = -std::numeric_limits<double>::infinity();
+    for (int i = 0; i < config.numIslands; ++i) {
+        if (layout.island(i)->sampleRows.load(std::memory_order_acquire) == 0) continue;
+        for (int c = 0; c < numPolicies; ++c) {
+            const double* points = layout.objectives(i, 0, c);
+            for (int p = 0; p < config.populationSize; ++p) {
+                if (std::isfinite(points[2 * p])) refF1 = std::max(refF1, points[2 * p]);
+                if (std::isfinite(points[2 * p + 1])) refF2 = std::max(refF2, points[2 * p + 1]);
+            }
+        }
+    }
+    referencePoint = qMakePair(refF1 + 80, refF2 + 80);
+
+    // Historial agregado: hipervolumen del frente combinado de las islas que llegaron
+    // a cada generación de muestreo
+    for (int row = 0; row < sampleRowCount(h); ++row) {
+        QVector<double> values(numPolicies, 0.0);
+        bool reported = false;
+
+        for (int c = 0; c < numPolicies; ++c) {
+            QVector<QPair<double, double>> merged;
+            for (int i = 0; i < config.numIslands; ++i) {
+                if (layout.island(i)->sampleRows.load(std::memory_order_acquire) <= row) continue;
+                const double* points = layout.objectives(i, row, c);
+                for (int p = 0; p < config.populationSize; ++p) {
+                    merged.append(qMakePair(points[2 * p], points[2 * p + 1]));
+                }
+                reported = true;
+            }
+            values[c] = hypervolume2D(merged, referencePoint.first, referencePoint.second);
+        }
+
+        if (!reported) break;
+        hypervolumes.append(values);
+        hypervolumeGenerations.append(sampleGeneration(h, row));
+    }
+
+    // Frente global a partir de la última población publicada por cada isla
+    QVector<Individual> merged;
+    QVector<Individual> population;
+    for (int i = 0; i < config.numIslands; ++i) {
+        if (readPopulation(layout, i, config.policyNames, population)) {
+            merged += population;
+        }
+    }
+    globalFront = extractGlobalFront(merged);
+
+    return true;
+}
+
+const QVector<QVector<double>>& IslandCoordinator::getHypervolumes() const {
+    return hypervolumes;
+}
+
+const QVector<int>& IslandCoordinator::getHypervolumeGenerations() const {
+    return hypervolumeGenerations;
+}
+
+QPair<double, double> IslandCoordinator::getReferencePoint() const {
+    return referencePoint;
+}
+
+const QVector<Individual>& IslandCoordinator::getGlobalFront() const {
+    return globalFront;
+}
+
+const QVector<int>& IslandCoordinator::getFailedIslands() const {
+    return failedIslands;
+}
+
+std::uint64_t IslandCoordinator::getSeed() const {
+    return config.seed;
+}
+
+// ================= Trabajador =================
+
+int runIslandWorker(const QString& key, int index) {
+    QSharedMemory memory(key);
+    if (!memory.attach()) {
+        qWarning() << "Trabajador" << index << "no pudo adjuntar la memoria compartida:" << memory.errorString();
+        return 1;
+    }
+
+    SharedLayout layout(memory.data());
+    const SharedHeader& h = *layout.header();
+    if (h.magic != kMagic || h.layoutVersion != kLayoutVersion || index < 0 || index >= h.numIslands) {
+        qWarning() << "Segmento de islas incompatible";
+        return 1;
+    }
+
+    IslandHeader* self = layout.island(index);
+    self->heartbeatMs.store(nowMs());
+
+    QVector<QString> policyNames;
+    for (const QString& name : QString::fromUtf8(h.policyNames).split(',')) {
+        policyNames.append(name);
+    }
+
+    std::shared_ptr<const ScenarioData> scenario;
+    try {
+        scenario = std::make_shared<const ScenarioData>(
+            loadScenario(QString::fromUtf8(h.scenarioPath), policyNames));
+    } catch (const std::exception& e) {
+        qWarning() << "Trabajador" << index << "no pudo cargar el escenario:" << e.what();
+        return 1;
+    }
+    if (scenario->totalOperations != h.geneCount) {
+        qWarning() << "El escenario no coincide con el del coordinador";
+        return 1;
+    }
+
+    QVector<float> mutationRates(h.mutationRates, h.mutationRates + MutationCount);
+    EvolutionaryAlgorithm island(scenario, policyNames, h.populationSize,
+                                 h.crossoverRate, mutationRates, h.seed);
+
+    // Mismo reparto de flujos que IslandModel: la isla i recibe el (i+1)-ésimo split
+    Rng master(h.seed);
+    Rng stream = master.split();
+    for (int i = 0; i < index; ++i) {
+        stream = master.split();
+    }
+    island.setRandomStream(stream);
+
+    self->state.store(IslandRunning);
+    island.initialize();
+    publishObjectives(layout, index, island.getPopulation());
+    publishPopulation(layout, index, island.getPopulation());
+
+    const int next = (index + 1) % h.numIslands;
+
+    for (int gen = 1; gen <= h.numGenerations; ++gen) {
+        island.runGeneration();
+        if (isSampleGeneration(h, gen)) {
+            publishObjectives(layout, index, island.getPopulation());
+        }
+        self->heartbeatMs.store(nowMs());
+
+        if (gen % h.migrationInterval == 0) {
+            if (next != index) {
+                pushMigrants(layout, next, encodeIndividuals(island.getEmigrants(h.migrantsPerExchange)));
+            }
+            island.acceptImmigrants(popMigrants(layout, index, policyNames));
+            publishPopulation(layout, index, island.getPopulation());
+        }
+    }
+
+    publishPopulation(layout, index, island.getPopulation());
+    self->state.store(IslandFinished);
+    return 0;
+}
@@ -0,0 +1,100 @@
+#ifndef SHM_ISLANDS_H
+#define SHM_ISLANDS_H
+
+#include <QVector>
+#include <QString>
+#include <QPair>
+#include <cstdint>
+#include "EvolutionaryAlgorithm.h"
+
+/**
+ * @brief Parámetros del modelo de islas multiproceso
+ */
+struct ShmIslandConfig {
+    QString scenarioPath;                   // Cada proceso carga el escenario por su cuenta
+    QVector<QString> policyNames = {"FIFO", "LTP"};
+
+    int numIslands = 4;                     // Un proceso trabajador por isla
+    int numGenerations = 100;
+    int migrationInterval = 10;             // Se migra (y se publica el frente) cada K generaciones
+    int migrantsPerExchange = 2;
+    int ringSlots = 4;                      // Lotes de migrantes en espera por isla
+
+    int populationSize = 50;                // Tamaño de población de CADA isla
+    float crossoverRate = 0.8f;
+    QVector<float> mutationRates = QVector<float>(MutationCount, 0.1f);
+
+    std::uint64_t seed = 0;                 // Semilla global (0 = aleatoria, se reporta)
+    int heartbeatTimeoutMs = 60000;         // Sin latido en este tiempo → el proceso se termina
+};
+
+/**
+ * @brief Coordinador de islas en procesos separados de la misma máquina
+ *
+ * Crea un segmento de memoria compartida con, por cada isla:
+ * - un anillo SPSC de lotes de migrantes (topología en anillo: i → i+1),
+ * - su última población publicada, en doble búfer (si el proceso muere mientras
+ *   escribe, la publicación anterior sigue completa),
+ * - los objetivos de su población en la generación 0, cada migrationInterval
+ *   generaciones y la última.
+ *
+ * Lanza el propio ejecutable en modo trabajador (--island-worker) una vez por
+ * isla y vigila los procesos. Si un trabajador muere, su isla deja de avanzar
+ * pero el resto continúa; su última población e historial siguen disponibles en
+ * el segmento. Todo ocurre en localhost, sin red.
+ *
+ * El segmento es un QSharedMemory: en Unix lo respalda memoria System V con Qt 5
+ * y memoria POSIX con Qt 6.6 o posterior.
+ */
+class IslandCoordinator {
+public:
+    explicit IslandCoordinator(const ShmIslandConfig& config);
+
+    /**
+     * @brief Ejecuta la corrida completa (bloquea hasta que terminan todos los trabajadores)
+     * @return false si no se pudo crear el segmento o cargar el escenario
+     */
+    bool run();
+
+    /**
+     * @brief Historial agregado: por generación de muestreo y política, hipervolumen
+     * de la unión de las poblaciones de las islas que alcanzaron esa generación,
+     * todo respecto al mismo punto de referencia (getReferencePoint())
+     */
+    const QVector<QVector<double>>& getHypervolumes() const;
+
+    /** @brief Generación de cada fila de getHypervolumes() (0, K, 2K, ..., última) */
+    const QVector<int>& getHypervolumeGenerations() const;
+
+    /**
+     * @brief (makespan, energía) de referencia del historial: peores objetivos de las
+     * poblaciones iniciales de todas las islas + 80, como hace el motor con una sola
+     */
+    QPair<double, double> getReferencePoint() const;
+
+    /** @brief Frente global de las últimas poblaciones publicadas por todas las islas */
+    const QVector<Individual>& getGlobalFront() const;
+
+    /** @brief Islas cuyo proceso terminó antes de completar la corrida */
+    const QVector<int>& getFailedIslands() const;
+
+    std::uint64_t getSeed() const;
+
+private:
+    ShmIslandConfig config;
+    QVector<QVector<double>> hypervolumes;
+    QVector<int> hypervolumeGenerations;
+    QPair<double, double> referencePoint;
+    QVector<Individual> globalFront;
+    QVector<int> failedIslands;
+};
+
+/**
+ * @brief Punto de entrada del proceso trabajador
+ * @param key Clave del segmento de memoria compartida creado por el coordinador
+ * @param index Isla que le corresponde a este proceso
+ * @return Código de salida del proceso (0 = corrida completa)
+ */
+int runIslandWorker(const QString& key, int index);
+
+#endif // SHM_ISLANDS_H
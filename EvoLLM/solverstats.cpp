@@ -0,0 +1,95 @@
+#include "solverstats.h"
+
+#include <algorithm>
+
+// ================= Nombres y formato =================
+
+QString solverPhaseName(int phase) {
+    switch (phase) {
+    case PhaseSelection:   return "Selección";
+    case PhaseCrossover:   return "Cruza";
+    case PhaseEvaluation:  return "Evaluación";
+    case PhaseMutation:    return "Mutación";
+    case PhaseSorting:     return "Ordenamiento";
+    case PhaseSurvival:    return "Supervivencia";
+    case PhaseHypervolume: return "Hipervolumen";
+    default:               return "?";
+    }
+}
+
+double SolverStats::cacheHitRate() const {
+    return cacheLookups > 0 ? double(cacheHits) / cacheLookups : -1.0;
+}
+
+QString formatSolverStats(const SolverStats& stats) {
+    QString line = QString("gen %1 evals %2 evals/s %3 gen/s %4")
+                       .arg(stats.generations)
+                       .arg(stats.evaluations)
+                       .arg(stats.evaluationsPerSecond, 0, 'f', 1)
+                       .arg(stats.generationsPerSecond, 0, 'f', 2);
+
+    for (int p = 0; p < PhaseCount; ++p) {
+        line += QString(" %1_ms %2").arg(solverPhaseName(p).toLower()).arg(stats.phaseMs[p], 0, 'f', 2);
+    }
+
+    if (stats.cacheLookups > 0) {
+        line += QString(" cache %1").arg(stats.cacheHitRate(), 0, 'f', 3);
+    }
+    if (stats.etaSeconds >= 0.0) {
+        line += QString(" eta_s %1").arg(stats.etaSeconds, 0, 'f', 1);
+    }
+    return line;
+}
+
+// ================= Ventana móvil =================
+
+ThroughputMeter::ThroughputMeter(int window)
+    : window(std::max(1, window)),
+    origin(Clock::now()) {
+}
+
+void ThroughputMeter::reset() {
+    samples.clear();
+    origin = Clock::now();
+}
+
+void ThroughputMeter::addSample(long long evaluations, int generations,
+                                const std::array<long long, PhaseCount>& phaseNs) {
+    const double seconds = std::chrono::duration<double>(Clock::now() - origin).count();
+    samples.append({seconds, evaluations, generations, phaseNs});
+
+    if (samples.size() > window + 1) {
+        samples.removeFirst();
+    }
+}
+
+SolverStats ThroughputMeter::stats() const {
+    SolverStats stats;
+    if (samples.isEmpty()) {
+        return stats;
+    }
+
+    const Sample& last = samples.last();
+    stats.evaluations = last.evaluations;
+    stats.generations = last.generations;
+    stats.elapsedSeconds = last.seconds;
+
+    if (samples.size() < 2) {
+        return stats;
+    }
+
+    const Sample& first = samples.first();
+    const double seconds = last.seconds - first.seconds;
+    if (seconds > 0.0) {
+        stats.evaluationsPerSecond = (last.evaluations - first.evaluations) / seconds;
+        stats.generationsPerSecond = (last.generations - first.generations) / seconds;
+    }
+
+    // Por generación; si la ventana no tiene generaciones (estacionario), por muestra
+    const int generations = last.generations - first.generations;
+    const int divisor = generations > 0 ? generations : samples.size() - 1;
+    for (int p = 0; p < PhaseCount; ++p) {
+        stats.phaseMs[p] = (last.phaseNs[p] - first.phaseNs[p]) / 1e6 / divisor;
+    }
+    return stats;
+}
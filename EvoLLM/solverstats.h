@@ -0,0 +1,107 @@
+#ifndef SOLVER_STATS_H
+#define SOLVER_STATS_H
+
+#include <QString>
+#include <QVector>
+#include <array>
+#include <chrono>
+
+/**
+ * @file SolverStats.h
+ * @brief Métricas de rendimiento del motor: rendimiento en ventana móvil,
+ * tiempo por fase y tiempo estimado para agotar el presupuesto
+ */
+
+/**
+ * @brief Fases de una generación cuyo tiempo se mide por separado
+ */
+enum SolverPhase {
+    PhaseSelection,
+    PhaseCrossover,
+    PhaseEvaluation,
+    PhaseMutation,
+    PhaseSorting,
+    PhaseSurvival,
+    PhaseHypervolume,
+    PhaseCount
+};
+
+/** @brief Nombre corto de la fase para tablas y registros */
+QString solverPhaseName(int phase);
+
+/**
+ * @brief Instantánea del rendimiento del motor (se copia libremente entre hilos)
+ */
+struct SolverStats {
+    long long evaluations = 0;              // Desde la creación del motor
+    int generations = 0;                    // Generaciones completas desde la creación del motor
+    double elapsedSeconds = 0.0;            // Desde la primera medición
+
+    // Ventana móvil de las últimas generaciones
+    double evaluationsPerSecond = 0.0;
+    double generationsPerSecond = 0.0;
+
+    /**
+     * Milisegundos de trabajo por generación en cada fase (índice SolverPhase).
+     * Es la suma entre hilos, así que con varios hilos puede superar la duración
+     * real de la generación.
+     */
+    QVector<double> phaseMs = QVector<double>(PhaseCount, 0.0);
+
+    // Caché de programaciones decodificadas (la llena quien la tenga; 0 = sin caché)
+    long long cacheHits = 0;
+    long long cacheLookups = 0;
+
+    double etaSeconds = -1.0;               // Hasta agotar el presupuesto de evolve() (-1 = desconocido)
+    double budgetFraction = 0.0;            // Parte consumida del presupuesto [0, 1]
+
+    /** @return Aciertos / consultas, o -1 si no hubo consultas */
+    double cacheHitRate() const;
+};
+
+/** @brief Resumen en una línea (para registros y la salida sin interfaz) */
+QString formatSolverStats(const SolverStats& stats);
+
+/**
+ * @brief Ventana deslizante de muestras acumuladas del motor
+ *
+ * Cada muestra guarda contadores acumulados (evaluaciones, generaciones y
+ * nanosegundos por fase) con su instante; las tasas salen de la diferencia
+ * entre la muestra más nueva y la más antigua de la ventana, así que el costo
+ * no depende de la duración de la corrida. No es segura entre hilos: el motor
+ * la protege con su propio candado.
+ */
+class ThroughputMeter {
+public:
+    /** @param window Número de muestras que abarca la ventana */
+    explicit ThroughputMeter(int window = 20);
+
+    /** @brief Borra las muestras y pone el reloj en cero */
+    void reset();
+
+    /**
+     * @brief Registra los contadores acumulados en este instante
+     * @param phaseNs Nanosegundos de trabajo acumulados por fase
+     */
+    void addSample(long long evaluations, int generations,
+                   const std::array<long long, PhaseCount>& phaseNs);
+
+    /** @brief Tasas y tiempos por fase de la ventana actual (sin caché ni ETA) */
+    SolverStats stats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Sample {
+        double seconds;
+        long long evaluations;
+        int generations;
+        std::array<long long, PhaseCount> phaseNs;
+    };
+
+    int window;
+    Clock::time_point origin;
+    QVector<Sample> samples;                // A lo sumo window + 1, la más antigua primero
+};
+
+#endif // SOLVER_STATS_H
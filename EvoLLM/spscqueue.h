@@ -0,0 +1,76 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @file SpscQueue.h
+ * @brief Cola acotada sin bloqueos (lock-free) de un productor y un consumidor
+ *
+ * Anillo de capacidad fija con índices atómicos de lectura/escritura. Se usa para
+ * el intercambio de migrantes entre islas: cada arista dirigida de la topología
+ * tiene su propia cola, por lo que siempre hay un solo productor y un solo consumidor.
+ *
+ * T debe tener constructor por defecto y ser asignable por movimiento.
+ */
+template <typename T>
+class SpscQueue {
+public:
+    /**
+     * @param capacity Número máximo de elementos almacenados simultáneamente
+     */
+    explicit SpscQueue(std::size_t capacity)
+        : slots(capacity + 1), head(0), tail(0) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief Inserta sin bloquear (solo desde el hilo productor)
+     * @return false si la cola está llena (el elemento no se inserta)
+     */
+    bool tryPush(T value) {
+        const std::size_t t = tail.load(std::memory_order_relaxed);
+        const std::size_t next = increment(t);
+        if (next == head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        slots[t] = std::move(value);
+        tail.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Extrae sin bloquear (solo desde el hilo consumidor)
+     * @return false si la cola está vacía
+     */
+    bool tryPop(T& out) {
+        const std::size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        out = std::move(slots[h]);
+        slots[h] = T();             // Libera recursos del elemento consumido
+        head.store(increment(h), std::memory_order_release);
+        return true;
+    }
+
+    bool isEmpty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+private:
+    std::vector<T> slots;           // Una posición extra para distinguir lleno de vacío
+
+    // Índices en líneas de caché distintas para evitar false sharing
+    alignas(64) std::atomic<std::size_t> head;
+    alignas(64) std::atomic<std::size_t> tail;
+
+    std::size_t increment(std::size_t i) const {
+        return (i + 1) % slots.size();
+    }
+};
+
+#endif // SPSC_QUEUE_H
@@ -0,0 +1,325 @@
+#include "taskscheduler.h"
+
+#include <algorithm>
+#include <chrono>
+
+// ================= Deque Chase-Lev =================
+
+// Deque acotado (sin redimensionar): si se llena, la tarea va a la cola de desborde
+class TaskScheduler::WorkStealingDeque {
+public:
+    explicit WorkStealingDeque(std::int64_t capacity)
+        : buffer(capacity), mask(capacity - 1) {}
+
+    // Solo el dueño
+    bool push(TaskGraph::Task* task) {
+        std::int64_t b = bottom.load(std::memory_order_relaxed);
+        std::int64_t t = top.load(std::memory_order_acquire);
+        if (b - t >= static_cast<std::int64_t>(buffer.size())) {
+            return false;
+        }
+        buffer[b & mask].store(task, std::memory_order_relaxed);
+        bottom.store(b + 1, std::memory_order_release);     // Publica la tarea a los ladrones
+        return true;
+    }
+
+    // Solo el dueño (LIFO: lo más reciente suele estar en caché)
+    TaskGraph::Task* pop() {
+        std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top.load(std::memory_order_relaxed);
+
+        TaskGraph::Task* task = nullptr;
+        if (t <= b) {
+            task = buffer[b & mask].load(std::memory_order_relaxed);
+            if (t == b) {
+                // Último elemento: se compite con los ladrones
+                if (!top.compare_exchange_strong(t, t + 1,
+                                                 std::memory_order_seq_cst,
+                                                 std::memory_order_relaxed)) {
+                    task = nullptr;
+                }
+                bottom.store(b + 1, std::memory_order_relaxed);
+            }
+        } else {
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return task;
+    }
+
+    // Cualquier otro trabajador (FIFO: roba lo más antiguo)
+    TaskGraph::Task* steal() {
+        std::int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t b = bottom.load(std::memory_order_acquire);
+
+        if (t < b) {
+            TaskGraph::Task* task = buffer[t & mask].load(std::memory_order_relaxed);
+            if (top.compare_exchange_strong(t, t + 1,
+                                            std::memory_order_seq_cst,
+                                            std::memory_order_relaxed)) {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    std::vector<std::atomic<TaskGraph::Task*>> buffer;
+    std::int64_t mask;
+    alignas(64) std::atomic<std::int64_t> top{0};
+    alignas(64) std::atomic<std::int64_t> bottom{0};
+};
+
+// ================= TaskGraph =================
+
+int TaskGraph::addTask(TaskFunction fn, const QVector<int>& deps) {
+    int id = static_cast<int>(tasks.size());
+    tasks.emplace_back();
+    Task& task = tasks.back();
+    task.fn = std::move(fn);
+    task.graph = this;
+    task.pending.store(deps.size(), std::memory_order_relaxed);
+
+    for (int dep : deps) {
+        tasks[dep].successors.push_back(id);
+    }
+    return id;
+}
+
+QVector<int> TaskGraph::addParallelFor(int begin, int end, int grain,
+                                       RangeFunction fn,
+                                       const QVector<int>& deps) {
+    QVector<int> ids;
+    grain = std::max(1, grain);
+
+    int chunk = 0;
+    for (int b = begin; b < end; b += grain, ++chunk) {
+        int e = std::min(end, b + grain);
+        ids.append(addTask([fn, b, e, chunk](int worker) { fn(b, e, chunk, worker); }, deps));
+    }
+    return ids;
+}
+
+int TaskGraph::addJoin(const QVector<int>& deps) {
+    return addTask([](int) {}, deps);
+}
+
+int TaskGraph::size() const {
+    return static_cast<int>(tasks.size());
+}
+
+// ================= TaskScheduler =================
+
+TaskScheduler::TaskScheduler(int numWorkers) {
+    if (numWorkers <= 0) {
+        numWorkers = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (int i = 0; i < numWorkers; ++i) {
+        auto worker = std::make_unique<Worker>();
+        worker->deque = std::make_unique<WorkStealingDeque>(4096);
+        worker->victimSeed = 0x9e3779b97f4a7c15ULL * (i + 1);
+        workers.push_back(std::move(worker));
+    }
+
+    // El trabajador 0 es el hilo que llama a run()
+    for (int i = 1; i < numWorkers; ++i) {
+        threads.emplace_back(&TaskScheduler::workerLoop, this, i);
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+int TaskScheduler::getNumWorkers() const {
+    return static_cast<int>(workers.size());
+}
+
+void TaskScheduler::run(TaskGraph& graph) {
+    if (graph.tasks.empty()) return;
+
+    std::lock_guard<std::mutex> runLock(runMutex);
+    auto start = std::chrono::steady_clock::now();
+
+    graph.remaining.store(graph.size(), std::memory_order_relaxed);
+    graph.error = nullptr;
+
+    // Las tareas sin dependencias se reparten desde el deque del trabajador 0. Se
+    // eligen antes de encolar ninguna: en cuanto hay una encolada, otro trabajador
+    // puede ejecutarla y dejar en 0 el 'pending' de sus sucesores
+    std::vector<TaskGraph::Task*> roots;
+    for (TaskGraph::Task& task : graph.tasks) {
+        if (task.pending.load(std::memory_order_relaxed) == 0) {
+            roots.push_back(&task);
+        }
+    }
+    for (TaskGraph::Task* task : roots) {
+        schedule(task, 0);
+    }
+
+    // El hilo llamador también trabaja; sin tareas a mano espera a que aparezcan
+    // más o a que la última tarea del grafo lo despierte
+    while (graph.remaining.load(std::memory_order_acquire) > 0) {
+        const std::uint64_t epoch = workEpoch.load(std::memory_order_seq_cst);
+        if (executeOne(0)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepers.fetch_add(1, std::memory_order_seq_cst);
+        graphDone.wait(lock, [&] {
+            return graph.remaining.load(std::memory_order_acquire) == 0
+                   || workEpoch.load(std::memory_order_seq_cst) != epoch;
+        });
+        sleepers.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    runNanos += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+
+    if (graph.error) {
+        std::rethrow_exception(graph.error);
+    }
+}
+
+void TaskScheduler::workerLoop(int index) {
+    while (true) {
+        // La época se lee antes de buscar: si alguien encola después, la espera no se pierde
+        const std::uint64_t epoch = workEpoch.load(std::memory_order_seq_cst);
+        if (executeOne(index)) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepers.fetch_add(1, std::memory_order_seq_cst);
+        wakeUp.wait(lock, [&] {
+            return stopping || workEpoch.load(std::memory_order_seq_cst) != epoch;
+        });
+        sleepers.fetch_sub(1, std::memory_order_relaxed);
+        if (stopping) return;
+    }
+}
+
+bool TaskScheduler::executeOne(int index) {
+    TaskGraph::Task* task = findTask(index);
+    if (!task) return false;
+
+    execute(task, index);
+    return true;
+}
+
+TaskGraph::Task* TaskScheduler::findTask(int index) {
+    Worker& self = *workers[index];
+
+    if (TaskGraph::Task* task = self.deque->pop()) {
+        return task;
+    }
+
+    // Robar a víctimas en orden aleatorio
+    const int n = static_cast<int>(workers.size());
+    if (n > 1) {
+        std::uint64_t x = self.victimSeed;
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        self.victimSeed = x;
+
+        const int first = static_cast<int>(x % n);
+        for (int k = 0; k < n; ++k) {
+            int victim = (first + k) % n;
+            if (victim == index) continue;
+            if (TaskGraph::Task* task = workers[victim]->deque->steal()) {
+                self.stolen++;
+                return task;
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(overflowMutex);
+    if (!overflow.empty()) {
+        TaskGraph::Task* task = overflow.back();
+        overflow.pop_back();
+        return task;
+    }
+    return nullptr;
+}
+
+void TaskScheduler::execute(TaskGraph::Task* task, int index) {
+    TaskGraph& graph = *task->graph;
+    Worker& self = *workers[index];
+    auto start = std::chrono::steady_clock::now();
+
+    try {
+        task->fn(index);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(graph.errorMutex);
+        if (!graph.error) graph.error = std::current_exception();
+    }
+
+    self.busyNanos += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now() - start).count();
+    self.executed++;
+
+    // Liberar sucesores antes de marcar esta tarea como terminada
+    for (int successor : task->successors) {
+        TaskGraph::Task& next = graph.tasks[successor];
+        if (next.pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            schedule(&next, index);
+        }
+    }
+
+    // Después de esto el grafo puede destruirse: ya no se toca
+    if (graph.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        graphDone.notify_all();
+    }
+}
+
+void TaskScheduler::schedule(TaskGraph::Task* task, int index) {
+    if (!workers[index]->deque->push(task)) {
+        std::lock_guard<std::mutex> lock(overflowMutex);
+        overflow.push_back(task);
+    }
+    notifyWork();
+}
+
+void TaskScheduler::notifyWork() {
+    workEpoch.fetch_add(1, std::memory_order_seq_cst);
+    if (sleepers.load(std::memory_order_seq_cst) > 0) {
+        // El candado ordena este aviso con la comprobación del durmiente
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        wakeUp.notify_one();
+        graphDone.notify_all();
+    }
+}
+
+QVector<WorkerStats> TaskScheduler::getWorkerStats() const {
+    QVector<WorkerStats> stats;
+    const double total = runNanos.load() * 1e-9;
+
+    for (const auto& worker : workers) {
+        WorkerStats s;
+        s.busySeconds = worker->busyNanos.load() * 1e-9;
+        s.utilization = total > 0.0 ? s.busySeconds / total : 0.0;
+        s.tasksExecuted = worker->executed.load();
+        s.tasksStolen = worker->stolen.load();
+        stats.append(s);
+    }
+    return stats;
+}
+
+void TaskScheduler::resetStats() {
+    runNanos = 0;
+    for (auto& worker : workers) {
+        worker->busyNanos = 0;
+        worker->executed = 0;
+        worker->stolen = 0;
+    }
+}
@@ -0,0 +1,163 @@
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#include <QVector>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @file TaskScheduler.h
+ * @brief Planificador de tareas con robo de trabajo (work stealing)
+ *
+ * Cada hilo trabajador tiene un deque Chase-Lev: el dueño apila/desapila por
+ * abajo y los demás roban por arriba cuando se quedan sin trabajo. Así, las
+ * porciones (chunks) más costosas que otras (cromosomas largos, fallos de caché...)
+ * se reparten solas entre los hilos.
+ *
+ * El trabajo se describe como un grafo de tareas (TaskGraph): cada tarea se
+ * ejecuta en cuanto todas sus dependencias terminan.
+ */
+
+class TaskScheduler;
+
+/**
+ * @brief Grafo de tareas con dependencias
+ *
+ * Se construye en un solo hilo y se ejecuta con TaskScheduler::run().
+ * Los identificadores de tarea son índices consecutivos empezando en 0.
+ */
+class TaskGraph {
+public:
+    /** Cuerpo de una tarea; recibe el índice del trabajador que la ejecuta */
+    using TaskFunction = std::function<void(int worker)>;
+
+    /** Cuerpo de un chunk de parallelFor: rango [begin, end), número de chunk y trabajador */
+    using RangeFunction = std::function<void(int begin, int end, int chunk, int worker)>;
+
+    /**
+     * @brief Añade una tarea
+     * @param deps Tareas que deben terminar antes
+     * @return Identificador de la nueva tarea
+     */
+    int addTask(TaskFunction fn, const QVector<int>& deps = {});
+
+    /**
+     * @brief Divide [begin, end) en chunks de 'grain' elementos, una tarea por chunk
+     * @param deps Dependencias comunes a todos los chunks
+     * @return Identificadores de los chunks, en orden
+     */
+    QVector<int> addParallelFor(int begin, int end, int grain,
+                                RangeFunction fn,
+                                const QVector<int>& deps = {});
+
+    /** @brief Tarea vacía que termina cuando terminan todas 'deps' (punto de unión) */
+    int addJoin(const QVector<int>& deps);
+
+    int size() const;
+
+private:
+    friend class TaskScheduler;
+
+    struct Task {
+        TaskFunction fn;
+        TaskGraph* graph = nullptr;         // Grafo dueño (sucesores, remaining y errores)
+        std::atomic<int> pending{0};        // Dependencias sin terminar
+        std::vector<int> successors;        // Tareas que esperan a esta
+    };
+
+    std::deque<Task> tasks;                 // deque: direcciones estables para los punteros
+    std::atomic<int> remaining{0};          // Tareas sin terminar durante run()
+
+    std::mutex errorMutex;
+    std::exception_ptr error;               // Primera excepción lanzada por una tarea
+};
+
+/**
+ * @brief Estadísticas acumuladas de un trabajador
+ */
+struct WorkerStats {
+    double busySeconds = 0.0;               // Tiempo ejecutando tareas
+    double utilization = 0.0;               // busySeconds / tiempo total dentro de run()
+    long long tasksExecuted = 0;
+    long long tasksStolen = 0;              // Tareas obtenidas robando a otro trabajador
+};
+
+/**
+ * @brief Conjunto de hilos trabajadores con robo de trabajo
+ *
+ * El hilo que llama a run() actúa como trabajador 0 mientras espera, de modo que
+ * con N trabajadores se crean N-1 hilos en segundo plano.
+ *
+ * Cada tarea conoce su grafo, así que un trabajador nunca usa un grafo distinto
+ * del de la tarea que obtuvo (aunque run() se llame muchas veces seguidas). Los
+ * trabajadores sin tareas duermen hasta que se encola una nueva; run() duerme
+ * hasta que hay trabajo o el grafo termina.
+ */
+class TaskScheduler {
+public:
+    /**
+     * @param numWorkers Número total de trabajadores (0 = núcleos disponibles)
+     */
+    explicit TaskScheduler(int numWorkers = 0);
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /**
+     * @brief Ejecuta todas las tareas del grafo respetando dependencias
+     * Bloquea hasta que terminan; si alguna lanzó una excepción, se relanza aquí.
+     */
+    void run(TaskGraph& graph);
+
+    int getNumWorkers() const;
+
+    /** @brief Estadísticas por trabajador (la utilización muestra el tiempo ocioso) */
+    QVector<WorkerStats> getWorkerStats() const;
+    void resetStats();
+
+private:
+    class WorkStealingDeque;
+
+    struct Worker {
+        std::unique_ptr<WorkStealingDeque> deque;
+        std::atomic<std::int64_t> busyNanos{0};
+        std::atomic<long long> executed{0};
+        std::atomic<long long> stolen{0};
+        std::uint64_t victimSeed = 0;       // Estado para elegir víctimas al azar
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+
+    std::mutex runMutex;                    // Un solo grafo a la vez
+    std::atomic<std::int64_t> runNanos{0};
+
+    std::mutex overflowMutex;               // Tareas que no cupieron en un deque
+    std::vector<TaskGraph::Task*> overflow;
+
+    // Espera sin girar: quien encola incrementa workEpoch y despierta a un durmiente
+    std::mutex sleepMutex;
+    std::condition_variable wakeUp;         // Trabajadores sin tareas
+    std::condition_variable graphDone;      // Hilo dentro de run()
+    std::atomic<std::uint64_t> workEpoch{0};
+    std::atomic<int> sleepers{0};
+    bool stopping = false;
+
+    void workerLoop(int index);
+    bool executeOne(int index);             // true si ejecutó alguna tarea
+    TaskGraph::Task* findTask(int index);
+    void execute(TaskGraph::Task* task, int index);
+    void schedule(TaskGraph::Task* task, int index);
+    void notifyWork();
+};
+
+#endif // TASK_SCHEDULER_H